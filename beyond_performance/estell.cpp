@@ -0,0 +1,581 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unwind.h>
+
+#include <bit>
+#include <cstdint>
+#include <cxxabi.h>
+#include <exception>
+#include <typeinfo>
+
+#include "estell.hpp"
+
+estell_statistics estell_stats{};
+
+namespace {
+constexpr std::uint32_t r_ip = 12;
+constexpr std::uint32_t r_sp = 13;
+constexpr std::uint32_t r_lr = 14;
+constexpr std::uint32_t r_pc = 15;
+
+constexpr std::uint32_t exidx_cantunwind = 1;
+constexpr std::uint32_t high_bit = 1u << 31;
+constexpr std::uint8_t opcode_finish = 0xB0;
+
+// Bits of demand_save_flags, see libgcc's unwind-arm-common.inc
+constexpr std::uint32_t demand_save_vfp = 1 << 0;
+constexpr std::uint32_t demand_save_vfp_d = 1 << 1;
+constexpr std::uint32_t demand_save_vfp3 = 1 << 2;
+
+struct core_regs
+{
+  std::uint32_t r[16];
+};
+
+/// Layout of libgcc's phase2_vrs, built by __wrap___cxa_throw
+struct phase2_vrs
+{
+  std::uint32_t demand_save_flags;
+  core_regs core;
+};
+
+/**
+ * @brief Layout of libgcc's phase1_vrs up to the VFP registers
+ *
+ * Personality routines and __gnu_unwind_execute take this as their
+ * _Unwind_Context. With demand_save_flags set, the first VFP pop saves the
+ * hardware registers here so they can be put back after the search phase.
+ * The iWMMXt registers that follow in libgcc are left out, Cortex-M has none.
+ */
+struct virtual_register_set
+{
+  std::uint32_t demand_save_flags;
+  core_regs core;
+  std::uint32_t prev_sp;
+  struct
+  {
+    std::uint64_t d[16];
+    std::uint32_t pad;
+  } vfp;
+  struct
+  {
+    std::uint64_t d[16];
+  } vfp_regs_16_to_31;
+};
+
+struct eit_entry
+{
+  std::uint32_t fnoffset;
+  std::uint32_t content;
+};
+
+/// Layout of the start of __cxxabiv1::__cxa_eh_globals
+struct eh_globals
+{
+  void* caught_exceptions;
+  unsigned int uncaught_exceptions;
+};
+
+using personality_routine = _Unwind_Reason_Code(_Unwind_State,
+                                                _Unwind_Control_Block*,
+                                                _Unwind_Context*);
+
+enum class frame_kind
+{
+  compact,
+  personality,
+  end,
+};
+
+/// Reads unwind opcodes the same way libgcc's next_unwind_byte does
+struct opcode_reader
+{
+  std::uint32_t data;
+  const std::uint32_t* next;
+  std::uint8_t bytes_left;
+  std::uint8_t words_left;
+
+  std::uint8_t next_byte()
+  {
+    if (bytes_left == 0) {
+      if (words_left == 0) {
+        return opcode_finish;
+      }
+      words_left--;
+      data = *(next++);
+      bytes_left = 3;
+    } else {
+      bytes_left--;
+    }
+    std::uint8_t byte = (data >> 24) & 0xFF;
+    data <<= 8;
+    return byte;
+  }
+};
+} // namespace
+
+extern "C"
+{
+  extern const eit_entry __exidx_start;
+  extern const eit_entry __exidx_end;
+
+#if defined(__ARM_FP)
+  void __gnu_Unwind_Restore_VFP(void*);
+  void __gnu_Unwind_Restore_VFP_D(void*);
+  void __gnu_Unwind_Restore_VFP_D_16_to_31(void*);
+#endif
+
+  [[noreturn]] void estell_restore_core_regs(core_regs* p_regs);
+  [[noreturn]] void estell_throw(void* p_object,
+                                 std::type_info* p_type,
+                                 void (*p_destructor)(void*),
+                                 phase2_vrs* p_entry);
+}
+
+namespace {
+std::uint32_t
+selfrel_offset31(const std::uint32_t* p_offset)
+{
+  std::uint32_t offset = *p_offset;
+  // Sign extend to 32 bits
+  if (offset & (1 << 30)) {
+    offset |= high_bit;
+  } else {
+    offset &= ~high_bit;
+  }
+  return offset + reinterpret_cast<std::uint32_t>(p_offset);
+}
+
+const eit_entry*
+search_exidx(std::uint32_t p_address)
+{
+  const eit_entry* table = &__exidx_start;
+  std::uint32_t count = &__exidx_end - &__exidx_start;
+
+  // Last entry whose function starts at or before p_address
+  std::uint32_t first = 0;
+  while (count > 0) {
+    std::uint32_t half = count / 2;
+    if (selfrel_offset31(&table[first + half].fnoffset) <= p_address) {
+      first += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+  if (first == 0) {
+    return nullptr;
+  }
+  return &table[first - 1];
+}
+
+_Unwind_Context*
+as_context(virtual_register_set& p_vrs)
+{
+  return reinterpret_cast<_Unwind_Context*>(&p_vrs);
+}
+
+personality_routine*
+personality_of(_Unwind_Control_Block* p_ucb)
+{
+  // UCB_PR_ADDR in libgcc
+  return reinterpret_cast<personality_routine*>(
+    p_ucb->unwinder_cache.reserved2);
+}
+
+/**
+ * @brief Find the exception index entry of a return address and fill in the
+ * pr_cache of the control block, like libgcc's get_eit_entry
+ */
+frame_kind
+find_frame(_Unwind_Control_Block* p_ucb, std::uint32_t p_return_address)
+{
+  // The return address is just past the call, step back into the call
+  // instruction so calls at the very end of a function are found.
+  const auto* entry = search_exidx(p_return_address - 2);
+  if (entry == nullptr || entry->content == exidx_cantunwind) {
+    return frame_kind::end;
+  }
+
+  p_ucb->pr_cache.fnstart = selfrel_offset31(&entry->fnoffset);
+  const std::uint32_t* ehtp = nullptr;
+  if (entry->content & high_bit) {
+    ehtp = &entry->content;
+    p_ucb->pr_cache.additional = 1;
+  } else {
+    ehtp = reinterpret_cast<const std::uint32_t*>(
+      selfrel_offset31(&entry->content));
+    p_ucb->pr_cache.additional = 0;
+  }
+  p_ucb->pr_cache.ehtp =
+    const_cast<_Unwind_EHT_Header*>(reinterpret_cast<const _uw*>(ehtp));
+
+  if (*ehtp & high_bit) {
+    // Compact model: __aeabi_unwind_cpp_pr0/1/2 with no descriptors, GCC
+    // never emits cleanups or handlers for these.
+    std::uint32_t index = (*ehtp >> 24) & 0xF;
+    p_ucb->unwinder_cache.reserved2 = 0;
+    return index <= 2 ? frame_kind::compact : frame_kind::end;
+  }
+
+  p_ucb->unwinder_cache.reserved2 = selfrel_offset31(ehtp);
+  return frame_kind::personality;
+}
+
+opcode_reader
+compact_opcodes(const std::uint32_t* p_ehtp)
+{
+  opcode_reader reader{
+    .data = *p_ehtp,
+    .next = p_ehtp + 1,
+    .bytes_left = 0,
+    .words_left = 0,
+  };
+  if (((reader.data >> 24) & 0xF) == 0) {
+    // su16: three opcodes in the same word
+    reader.data <<= 8;
+    reader.bytes_left = 3;
+  } else {
+    // lu16/lu32: two opcodes and a count of the words that follow
+    reader.words_left = (reader.data >> 16) & 0xFF;
+    reader.data <<= 16;
+    reader.bytes_left = 2;
+  }
+  return reader;
+}
+
+/// True if every opcode only touches the core registers
+bool
+uses_core_registers_only(opcode_reader p_reader)
+{
+  while (true) {
+    std::uint8_t op = p_reader.next_byte();
+    if (op == opcode_finish) {
+      return true;
+    }
+    if ((op & 0x80) == 0 || (op & 0xF0) == 0x90 || (op & 0xF0) == 0xA0) {
+      continue;
+    }
+    if ((op & 0xF0) == 0x80 || op == 0xB1) {
+      p_reader.next_byte();
+      continue;
+    }
+    if (op == 0xB2) {
+      while (p_reader.next_byte() & 0x80) {
+        continue;
+      }
+      continue;
+    }
+    return false;
+  }
+}
+
+void
+pop_core_registers(core_regs& p_regs, std::uint32_t p_mask)
+{
+  // Like _Unwind_VRS_Pop, sp is only taken from the stack if it is popped
+  const bool pops_sp = p_mask & (1 << r_sp);
+  auto* stack = reinterpret_cast<const std::uint32_t*>(p_regs.r[r_sp]);
+  while (p_mask) {
+    auto reg = std::countr_zero(p_mask);
+    p_mask &= p_mask - 1;
+    p_regs.r[reg] = *(stack++);
+  }
+  if (!pops_sp) {
+    p_regs.r[r_sp] = reinterpret_cast<std::uint32_t>(stack);
+  }
+}
+
+/**
+ * @brief The core register subset of __gnu_unwind_execute
+ *
+ * @return false if the opcodes refuse to unwind or are reserved
+ */
+bool
+execute_core_opcodes(core_regs& p_regs, opcode_reader p_reader)
+{
+  bool set_pc = false;
+  while (true) {
+    std::uint32_t op = p_reader.next_byte();
+    if (op == opcode_finish) {
+      break;
+    }
+    if ((op & 0x80) == 0) {
+      // vsp = vsp +- (imm6 << 2) + 4
+      std::uint32_t offset = ((op & 0x3F) << 2) + 4;
+      if (op & 0x40) {
+        p_regs.r[r_sp] -= offset;
+      } else {
+        p_regs.r[r_sp] += offset;
+      }
+    } else if ((op & 0xF0) == 0x80) {
+      op = (op << 8) | p_reader.next_byte();
+      if (op == 0x8000) {
+        // Refuse to unwind
+        return false;
+      }
+      // Pop r4-r15 under mask
+      std::uint32_t mask = (op << 4) & 0xFFF0;
+      pop_core_registers(p_regs, mask);
+      set_pc = set_pc || (mask & (1 << r_pc));
+    } else if ((op & 0xF0) == 0x90) {
+      // vsp = r[nnnn], 0x97 is the frame pointer of Thumb code
+      std::uint32_t reg = op & 0xF;
+      if (reg == r_sp || reg == r_pc) {
+        return false;
+      }
+      p_regs.r[r_sp] = p_regs.r[reg];
+    } else if ((op & 0xF0) == 0xA0) {
+      // Pop r4-r[4+nnn], [lr]
+      std::uint32_t mask = (0xFF0 >> (7 - (op & 7))) & 0xFF0;
+      if (op & 8) {
+        mask |= 1 << r_lr;
+      }
+      pop_core_registers(p_regs, mask);
+    } else if (op == 0xB1) {
+      // Pop r0-r3 under mask
+      op = p_reader.next_byte();
+      if (op == 0 || (op & 0xF0) != 0) {
+        return false;
+      }
+      pop_core_registers(p_regs, op);
+    } else if (op == 0xB2) {
+      // vsp = vsp + 0x204 + (uleb128 << 2)
+      std::uint32_t shift = 2;
+      op = p_reader.next_byte();
+      while (op & 0x80) {
+        p_regs.r[r_sp] += (op & 0x7F) << shift;
+        shift += 7;
+        op = p_reader.next_byte();
+      }
+      p_regs.r[r_sp] += ((op & 0x7F) << shift) + 0x204;
+    } else {
+      return false;
+    }
+  }
+  if (!set_pc) {
+    p_regs.r[r_pc] = p_regs.r[r_lr];
+  }
+  return true;
+}
+
+bool
+unwind_compact_frame(_Unwind_Control_Block* p_ucb, virtual_register_set& p_vrs)
+{
+  auto reader =
+    compact_opcodes(reinterpret_cast<const std::uint32_t*>(p_ucb->pr_cache.ehtp));
+
+  if (uses_core_registers_only(reader)) {
+    estell_stats.fast_frames++;
+    return execute_core_opcodes(p_vrs.core, reader);
+  }
+
+  estell_stats.execute_fallbacks++;
+  __gnu_unwind_state state{
+    .data = reader.data,
+    .next = const_cast<_uw*>(reader.next),
+    .bytes_left = reader.bytes_left,
+    .words_left = reader.words_left,
+  };
+  return __gnu_unwind_execute(as_context(p_vrs), &state) == _URC_OK;
+}
+
+void
+restore_non_core_registers([[maybe_unused]] virtual_register_set& p_vrs)
+{
+#if defined(__ARM_FP)
+  if ((p_vrs.demand_save_flags & demand_save_vfp) == 0) {
+    if (p_vrs.demand_save_flags & demand_save_vfp_d) {
+      __gnu_Unwind_Restore_VFP_D(&p_vrs.vfp);
+    } else {
+      __gnu_Unwind_Restore_VFP(&p_vrs.vfp);
+    }
+  }
+  if ((p_vrs.demand_save_flags & demand_save_vfp3) == 0) {
+    __gnu_Unwind_Restore_VFP_D_16_to_31(&p_vrs.vfp_regs_16_to_31);
+  }
+#endif
+}
+
+[[noreturn]] void
+unhandled(_Unwind_Control_Block* p_ucb)
+{
+  // Same as __cxa_throw when _Unwind_RaiseException returns
+  __cxxabiv1::__cxa_begin_catch(p_ucb);
+  std::terminate();
+}
+
+/**
+ * @brief Unwind until a personality routine installs a landing pad
+ *
+ * @param p_at_frame - p_ucb already describes the frame of p_vrs
+ */
+[[noreturn]] void
+unwind_phase2(_Unwind_Control_Block* p_ucb,
+              virtual_register_set& p_vrs,
+              bool p_at_frame)
+{
+  while (true) {
+    auto kind = frame_kind::personality;
+    if (!p_at_frame) {
+      kind = find_frame(p_ucb, p_vrs.core.r[r_pc]);
+    }
+    p_at_frame = false;
+
+    if (kind == frame_kind::end) {
+      unhandled(p_ucb);
+    }
+    if (kind == frame_kind::compact) {
+      if (!unwind_compact_frame(p_ucb, p_vrs)) {
+        unhandled(p_ucb);
+      }
+      continue;
+    }
+
+    estell_stats.personality_frames++;
+    // UCB_SAVED_CALLSITE_ADDR, _Unwind_Resume continues from here after a
+    // cleanup landing pad
+    p_ucb->unwinder_cache.reserved3 = p_vrs.core.r[r_pc];
+    auto result = personality_of(p_ucb)(
+      _US_UNWIND_FRAME_STARTING, p_ucb, as_context(p_vrs));
+    if (result == _URC_INSTALL_CONTEXT) {
+      estell_restore_core_regs(&p_vrs.core);
+    }
+    if (result != _URC_CONTINUE_UNWIND) {
+      unhandled(p_ucb);
+    }
+  }
+}
+} // namespace
+
+extern "C"
+{
+  void estell_throw(void* p_object,
+                    std::type_info* p_type,
+                    void (*p_destructor)(void*),
+                    phase2_vrs* p_entry)
+  {
+    estell_stats.throws++;
+
+    // What __cxa_throw does before _Unwind_RaiseException
+    auto* globals =
+      reinterpret_cast<eh_globals*>(__cxxabiv1::__cxa_get_globals());
+    globals->uncaught_exceptions++;
+    auto* header = __cxxabiv1::__cxa_init_primary_exception(
+      p_object, p_type, p_destructor);
+    // referenceCount is the first member of __cxa_refcounted_exception
+    *reinterpret_cast<int*>(header) = 1;
+    // The unwind header sits right before the thrown object
+    auto* ucb = reinterpret_cast<_Unwind_Control_Block*>(p_object) - 1;
+    // UCB_FORCED_STOP_FN
+    ucb->unwinder_cache.reserved1 = 0;
+
+    // Start at the call site of __cxa_throw
+    p_entry->core.r[r_pc] = p_entry->core.r[r_lr];
+
+    virtual_register_set vrs;
+    vrs.demand_save_flags = ~0u;
+    vrs.core = p_entry->core;
+
+    // Search phase. Compact frames are unwound in place, frames with a
+    // personality routine decide if they catch the exception.
+    bool personality_before_handler = false;
+    while (true) {
+      auto kind = find_frame(ucb, vrs.core.r[r_pc]);
+      if (kind == frame_kind::end) {
+        restore_non_core_registers(vrs);
+        unhandled(ucb);
+      }
+      if (kind == frame_kind::compact) {
+        if (!unwind_compact_frame(ucb, vrs)) {
+          restore_non_core_registers(vrs);
+          unhandled(ucb);
+        }
+        continue;
+      }
+
+      estell_stats.personality_frames++;
+      auto result = personality_of(ucb)(
+        _US_VIRTUAL_UNWIND_FRAME, ucb, as_context(vrs));
+      if (result == _URC_HANDLER_FOUND) {
+        break;
+      }
+      if (result != _URC_CONTINUE_UNWIND) {
+        restore_non_core_registers(vrs);
+        unhandled(ucb);
+      }
+      // This frame may own cleanups that have to run before the handler
+      personality_before_handler = true;
+    }
+
+    if (!personality_before_handler) {
+      // Nothing to clean up on the way, vrs already holds the state of the
+      // handler's frame and any VFP registers popped on the way are live.
+      unwind_phase2(ucb, vrs, true);
+    }
+
+    // Cleanup phase, walk again from the throw so every cleanup runs
+    estell_stats.cleanup_phases++;
+    restore_non_core_registers(vrs);
+    vrs.demand_save_flags = 0;
+    vrs.core = p_entry->core;
+    unwind_phase2(ucb, vrs, false);
+  }
+
+  /**
+   * @brief Replacement for __cxa_throw, link with -Wl,--wrap=__cxa_throw
+   *
+   * Saves the caller's registers as a phase2_vrs on the stack, like the
+   * _Unwind_RaiseException wrapper in libgcc, and hands them to estell_throw.
+   */
+  [[gnu::naked]] void __wrap___cxa_throw(void*,
+                                         std::type_info*,
+                                         void (*)(void*))
+  {
+    asm volatile(
+      // r15: the call site
+      "push {lr}\n"
+      // r13 and r14: sp and lr of the caller
+      "add ip, sp, #4\n"
+      "push {ip, lr}\n"
+      // r0-r12, ip is already clobbered but is not preserved across calls
+      "push {r0-r12}\n"
+      // demand_save_flags and padding to keep the stack 8 byte aligned
+      "sub sp, sp, #8\n"
+      "movs r4, #0\n"
+      "str r4, [sp, #4]\n"
+      "add r3, sp, #4\n"
+      "bl estell_throw\n");
+  }
+
+  /**
+   * @brief Load every core register and jump to the new pc
+   *
+   * Same as libgcc's restore_core_regs for Thumb-2: sp cannot be loaded with
+   * ldm, so the new pc is stored just below the new sp and popped from there.
+   * That memory belongs to the frames being unwound.
+   */
+  [[gnu::naked]] void estell_restore_core_regs(core_regs*)
+  {
+    asm volatile("add r1, r0, #52\n"
+                 "ldmia r1, {r3, r4, r5}\n"
+                 "mov ip, r3\n"
+                 "mov lr, r4\n"
+                 "str r5, [ip, #-4]!\n"
+                 "ldmia r0, {r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, sl, fp}\n"
+                 "mov sp, ip\n"
+                 "pop {pc}\n");
+  }
+}
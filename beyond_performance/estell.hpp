@@ -0,0 +1,53 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Estell exceptions: a throw path for ARM EHABI that only involves
+ * libgcc's unwinder for frames that need it
+ *
+ * Link the `estell` library, it wraps __cxa_throw. Every frame whose
+ * .ARM.exidx entry uses the compact model has no cleanups or handlers, so it
+ * is unwound in place by decoding its opcodes, which for frame pointer
+ * functions is `vsp = r7` followed by a pop of the saved registers. Frames
+ * with a personality routine are handed to it, and opcodes that touch more
+ * than the core registers go to __gnu_unwind_execute. If no frame between the
+ * throw and the catch has a personality routine, the search phase has already
+ * reached the handler's state and the cleanup phase is skipped.
+ *
+ * The runtime keeps no state between throws besides estell_stats, so tasks
+ * can throw at once as long as __cxa_get_globals returns their own globals,
+ * see exception_globals.hpp in ../performance. Exceptions thrown out of
+ * cleanups are handled by libgcc's _Unwind_Resume like before.
+ */
+struct estell_statistics
+{
+  /// Exceptions thrown through the runtime
+  std::atomic<std::uint32_t> throws = 0;
+  /// Frames unwound by the runtime's own opcode decoder
+  std::atomic<std::uint32_t> fast_frames = 0;
+  /// Frames with VFP or other non core opcodes, run by __gnu_unwind_execute
+  std::atomic<std::uint32_t> execute_fallbacks = 0;
+  /// Frames handed to their personality routine, in either phase
+  std::atomic<std::uint32_t> personality_frames = 0;
+  /// Throws that needed a second walk to run cleanups
+  std::atomic<std::uint32_t> cleanup_phases = 0;
+};
+
+/// Running totals since reset, inspect them with GDB
+extern estell_statistics estell_stats;
@@ -0,0 +1,117 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+
+#include "seqlock.hpp"
+
+/// Number of (thrown, caught) type pairs the personality routine remembers,
+/// 0 disables the cache
+#if !defined(CATCH_MATCH_CACHE_SIZE)
+#define CATCH_MATCH_CACHE_SIZE 0
+#endif
+
+/**
+ * @brief Cache of catch clause type matches
+ *
+ * Matching a handler calls the catch type's __do_catch, which walks the
+ * thrown type's bases until it finds the catch type. For a class thrown by
+ * value the result only depends on the two types: whether they match and
+ * how far the base is from the start of the thrown object. Direct mapped,
+ * a new pair evicts the one in its line. Lines are seqlock_line, so tasks
+ * can match at the same time and find() hands out a copy of the entry.
+ *
+ * @tparam size - number of entries, a power of two. 0 disables the cache.
+ */
+template<std::size_t size>
+class catch_match_cache
+{
+public:
+  static_assert(std::has_single_bit(size) || size == 0,
+                "size must be a power of two");
+
+  struct entry
+  {
+    // Null types never get here, so zero initialized entries are empty
+    const std::type_info* thrown = nullptr;
+    const std::type_info* caught = nullptr;
+    /// Bytes from the thrown object to its caught base
+    std::ptrdiff_t adjustment = 0;
+    bool matched = false;
+  };
+
+  /// @return false on a miss, p_entry holds the pair on a hit
+  [[gnu::always_inline]] bool find(const std::type_info* p_thrown,
+                                   const std::type_info* p_caught,
+                                   entry& p_entry)
+  {
+    if constexpr (size == 0) {
+      return false;
+    } else {
+      auto& line = m_lines[line_index(p_thrown, p_caught)];
+      if (line.load(p_entry) && p_entry.thrown == p_thrown &&
+          p_entry.caught == p_caught) {
+        hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+      misses.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  [[gnu::always_inline]] void insert(const std::type_info* p_thrown,
+                                     const std::type_info* p_caught,
+                                     bool p_matched,
+                                     std::ptrdiff_t p_adjustment)
+  {
+    if constexpr (size != 0) {
+      m_lines[line_index(p_thrown, p_caught)].store(
+        { p_thrown, p_caught, p_adjustment, p_matched });
+    }
+  }
+
+  /// Empties the cache, only while no task throws
+  void clear()
+  {
+    for (auto& line : m_lines) {
+      line.reset();
+    }
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+  }
+
+  std::atomic<std::uint32_t> hits = 0;
+  std::atomic<std::uint32_t> misses = 0;
+
+private:
+  static constexpr std::size_t line_count = (size == 0) ? 1 : size;
+
+  static std::size_t line_index(const std::type_info* p_thrown,
+                                const std::type_info* p_caught)
+  {
+    // type_info objects are word aligned
+    auto thrown = reinterpret_cast<std::uintptr_t>(p_thrown) >> 2;
+    auto caught = reinterpret_cast<std::uintptr_t>(p_caught) >> 2;
+    return (thrown ^ (caught * 3)) & (line_count - 1);
+  }
+
+  std::array<seqlock_line<entry>, (size == 0) ? 0 : size> m_lines{};
+};
@@ -0,0 +1,383 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Estimates Cortex-M4 cycles of a `step,function,address` instruction trace.
+
+Every traced address is decoded from the ELF and costed with the timings of
+the Cortex-M4 Technical Reference Manual:
+
+    data processing, MUL, MLA, long multiply        1
+    LDR, STR, LDRB, ...                             2, 1 after another one
+    LDRD, STRD                                      3
+    LDM, STM, PUSH, POP                             1 + registers
+    SDIV, UDIV                                      2 to 12, --divide
+    taken branch or write to PC                     + pipeline refill, --refill
+
+The LPC4078 adds flash wait states to fetches the flash accelerator has not
+prefetched. Those are the targets of taken branches and literal pool loads,
+each of which pays `--wait-states`. `enable_flash_accelerator()` writes 0xA
+to FLASHCFG at 0x400F'C000, FLASHTIM 0, so flash accesses take 1 CPU clock
+and the default is 0 wait states.
+
+    python3 cycle_model.py estimate build/MinSizeRel/except.qemu.elf \\
+        machine_code_steps.csv
+    python3 cycle_model.py validate build/MinSizeRel/except.qemu.elf \\
+        traces/ cycle_map.csv
+
+`validate` needs one trace per throw, as written by
+`trace_qemu.py --split-dir traces`. Throw n of the first pass is group n. The
+traces start at `__cxa_throw` and end on return to `start`, while `cycle_map`
+also has the allocation and the catch, so the report includes a linear fit of
+the measured cycles against the estimate to calibrate QEMU runs with.
+"""
+
+import argparse
+import collections
+import csv
+import re
+import struct
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+from elf_reader import elf_file
+from trace_profile import read_rows
+
+PC = 15
+
+ALU = "alu"
+LOAD_STORE = "load_store"
+LOAD_STORE_DOUBLE = "load_store_double"
+LOAD_STORE_MULTIPLE = "load_store_multiple"
+MULTIPLY = "multiply"
+DIVIDE = "divide"
+BRANCH = "branch"
+
+
+@dataclass
+class cost_parameters:
+    # Pipeline refill of a taken branch, 1 to 3 depending on the alignment
+    # and width of the target
+    refill: int = 2
+    # SDIV/UDIV take 2 to 12 cycles depending on the operands
+    divide: int = 7
+    wait_states: int = 0
+    # LPC4078 flash, 512KiB from 0
+    flash_end: int = 0x80000
+
+
+@dataclass
+class instruction:
+    size: int
+    kind: str = ALU
+    # Registers moved by LDM/STM/PUSH/POP
+    registers: int = 0
+    writes_pc: bool = False
+    literal: bool = False
+
+
+def popcount(value: int) -> int:
+    return bin(value).count("1")
+
+
+def decode_16(hw: int) -> instruction:
+    if (hw & 0xF000) == 0xD000 and (hw & 0x0F00) < 0x0E00:
+        return instruction(2, BRANCH)  # B<cond>
+    if (hw & 0xF800) == 0xE000:
+        return instruction(2, BRANCH)  # B
+    if (hw & 0xF500) == 0xB100:
+        return instruction(2, BRANCH)  # CBZ, CBNZ
+    if (hw & 0xFF00) == 0x4700:
+        return instruction(2, BRANCH)  # BX, BLX
+    if (hw & 0xFD00) == 0x4400 and ((hw >> 4) & 0x8 | hw & 0x7) == PC:
+        return instruction(2, ALU, writes_pc=True)  # ADD PC, MOV PC
+    if (hw & 0xFE00) == 0xB400:
+        return instruction(2, LOAD_STORE_MULTIPLE,  # PUSH
+                           registers=popcount(hw & 0x1FF))
+    if (hw & 0xFE00) == 0xBC00:
+        return instruction(2, LOAD_STORE_MULTIPLE,  # POP
+                           registers=popcount(hw & 0x1FF),
+                           writes_pc=bool(hw & 0x100))
+    if (hw & 0xF000) == 0xC000:
+        return instruction(2, LOAD_STORE_MULTIPLE,  # LDMIA, STMIA
+                           registers=popcount(hw & 0xFF))
+    if (hw & 0xF800) == 0x4800:
+        return instruction(2, LOAD_STORE, literal=True)  # LDR literal
+    if (hw & 0xF000) in (0x5000, 0x6000, 0x7000, 0x8000, 0x9000):
+        return instruction(2, LOAD_STORE)
+    if (hw & 0xFFC0) == 0x4340:
+        return instruction(2, MULTIPLY)  # MULS
+    return instruction(2, ALU)
+
+
+def decode_32(hw1: int, hw2: int) -> instruction:
+    if (hw1 & 0xF800) == 0xF000 and hw2 & 0x8000:
+        if (hw2 & 0x5000) == 0x0000 and (hw1 & 0x0380) == 0x0380:
+            return instruction(4, ALU)  # MSR, MRS, hints, barriers
+        return instruction(4, BRANCH)  # B<cond>.W, B.W, BL
+    if (hw1 & 0xFE40) == 0xE800 and (hw1 & 0x0180) in (0x0080, 0x0100):
+        registers = hw2 & 0xFFFF
+        return instruction(4, LOAD_STORE_MULTIPLE,  # LDM, STM
+                           registers=popcount(registers),
+                           writes_pc=bool(hw1 & 0x10 and registers & 0x8000))
+    if (hw1 & 0xFE40) == 0xE840:
+        if (hw1 & 0xFFF0) == 0xE8D0 and (hw2 & 0xFFE0) == 0xF000:
+            return instruction(4, LOAD_STORE, writes_pc=True)  # TBB, TBH
+        if hw1 & 0x0120:
+            return instruction(4, LOAD_STORE_DOUBLE,  # LDRD, STRD
+                               literal=(hw1 & 0x1F) == 0x1F)
+        return instruction(4, LOAD_STORE)  # LDREX, STREX
+    if (hw1 & 0xFE00) == 0xF800:
+        load = bool(hw1 & 0x10)
+        return instruction(4, LOAD_STORE,
+                           writes_pc=load and (hw2 >> 12) == PC,
+                           literal=load and (hw1 & 0xF) == PC)
+    if (hw1 & 0xFF80) == 0xFB00:
+        return instruction(4, MULTIPLY)  # MUL, MLA, MLS, SMUL<x><y>, ...
+    if (hw1 & 0xFF80) == 0xFB80:
+        if (hw1 & 0x0050) == 0x0010 and (hw2 & 0x00F0) == 0x00F0:
+            return instruction(4, DIVIDE)  # SDIV, UDIV
+        return instruction(4, MULTIPLY)  # UMULL, SMLAL, ...
+    if (hw1 & 0xFE00) == 0xEC00:
+        pre_index = hw1 & 0x0100
+        write_back = hw1 & 0x0020
+        if pre_index and not write_back:
+            return instruction(4, LOAD_STORE,  # VLDR, VSTR
+                               literal=(hw1 & 0x1F) == 0x1F)
+        if pre_index or write_back or hw1 & 0x0080:
+            # VLDM, VSTM, VPUSH, VPOP, the immediate is the number of words
+            return instruction(4, LOAD_STORE_MULTIPLE,
+                               registers=hw2 & 0xFF)
+    return instruction(4, ALU)
+
+
+class decoder:
+    def __init__(self, elf: elf_file):
+        self.elf = elf
+        self.cache: Dict[int, instruction] = {}
+
+    def __call__(self, address: int) -> instruction:
+        cached = self.cache.get(address)
+        if cached is not None:
+            return cached
+        # The last halfword of a section may be a 16 bit instruction
+        code = self.elf.read(address, 4).ljust(4, b"\0")
+        hw1, hw2 = struct.unpack("<HH", code)
+        if (hw1 >> 11) in (0b11101, 0b11110, 0b11111):
+            result = decode_32(hw1, hw2)
+        else:
+            result = decode_16(hw1)
+        self.cache[address] = result
+        return result
+
+
+class cost_model:
+    def __init__(self, elf: elf_file, parameters: cost_parameters):
+        self.decode = decoder(elf)
+        self.parameters = parameters
+        self.previous_kind: Optional[str] = None
+
+    def in_flash(self, address: int) -> bool:
+        return address < self.parameters.flash_end
+
+    def cycles(self, address: int, next_address: Optional[int]) -> int:
+        """Cycles of the instruction at `address`, followed by
+        `next_address` or None at the end of a trace"""
+        parameters = self.parameters
+        decoded = self.decode(address)
+        kind = decoded.kind
+
+        if kind == LOAD_STORE:
+            # Neighbouring loads and stores pipeline their address and data
+            cost = 1 if self.previous_kind == LOAD_STORE else 2
+        elif kind == LOAD_STORE_DOUBLE:
+            cost = 3
+        elif kind == LOAD_STORE_MULTIPLE:
+            cost = 1 + decoded.registers
+        elif kind == DIVIDE:
+            cost = parameters.divide
+        else:
+            cost = 1
+
+        if decoded.literal and self.in_flash(address):
+            cost += parameters.wait_states
+
+        if kind == BRANCH or decoded.writes_pc:
+            if next_address is None:
+                taken = decoded.writes_pc
+            else:
+                taken = next_address != address + decoded.size
+            if taken:
+                cost += parameters.refill
+                if next_address is None or self.in_flash(next_address):
+                    cost += parameters.wait_states
+                kind = BRANCH
+
+        self.previous_kind = kind
+        return cost
+
+
+@dataclass
+class function_cost:
+    instructions: int = 0
+    cycles: int = 0
+
+
+def estimate(elf: elf_file, trace: Path,
+             parameters: cost_parameters) -> Dict[str, function_cost]:
+    model = cost_model(elf, parameters)
+    result: Dict[str, function_cost] = collections.defaultdict(function_cost)
+    rows = list(read_rows(trace))
+    for index, (_, function, address) in enumerate(rows):
+        next_address = rows[index + 1][2] if index + 1 < len(rows) else None
+        cost = result[function]
+        cost.instructions += 1
+        cost.cycles += model.cycles(address, next_address)
+    return result
+
+
+def total(costs: Dict[str, function_cost]) -> function_cost:
+    return function_cost(sum(cost.instructions for cost in costs.values()),
+                         sum(cost.cycles for cost in costs.values()))
+
+
+def write_estimate(costs: Dict[str, function_cost], output):
+    writer = csv.writer(output)
+    writer.writerow(["function", "instructions", "cycles", "cpi"])
+    for function, cost in sorted(costs.items(),
+                                 key=lambda item: -item[1].cycles):
+        writer.writerow([function, cost.instructions, cost.cycles,
+                         f"{cost.cycles / cost.instructions:.2f}"])
+
+
+def read_measured(path: Path, column: str) -> Dict[int, int]:
+    """Cycles of each group, from a benchmark CSV or results.csv"""
+    with path.open(newline="") as file:
+        rows = list(csv.DictReader(file))
+    if not rows:
+        return {}
+    if column not in rows[0]:
+        raise RuntimeError(f"{path} has no {column} column")
+    result = {}
+    for index, row in enumerate(rows):
+        group = int(row.get("group_index", index))
+        if row[column]:
+            result[group] = int(float(row[column]))
+    return result
+
+
+def linear_fit(points: List[Tuple[float, float]]) -> Tuple[float, float,
+                                                            float]:
+    """Least squares y = slope * x + offset and its R squared"""
+    count = len(points)
+    mean_x = sum(x for x, _ in points) / count
+    mean_y = sum(y for _, y in points) / count
+    sxx = sum((x - mean_x) ** 2 for x, _ in points)
+    sxy = sum((x - mean_x) * (y - mean_y) for x, y in points)
+    syy = sum((y - mean_y) ** 2 for _, y in points)
+    slope = sxy / sxx if sxx else 0.0
+    offset = mean_y - slope * mean_x
+    r_squared = sxy * sxy / (sxx * syy) if sxx and syy else 0.0
+    return slope, offset, r_squared
+
+
+def validate(elf: elf_file, traces: Path, measured: Dict[int, int],
+             parameters: cost_parameters, output):
+    pattern = re.compile(r"throw_(\d+)\.csv")
+    writer = csv.writer(output)
+    writer.writerow(["group_index", "instructions", "estimated_cycles",
+                     "measured_cycles", "error_percent"])
+    points = []
+    for path in sorted(traces.iterdir(), key=lambda path: path.name):
+        match = pattern.fullmatch(path.name)
+        if match is None or int(match.group(1)) not in measured:
+            continue
+        group = int(match.group(1))
+        cost = total(estimate(elf, path, parameters))
+        cycles = measured[group]
+        error = 100 * (cost.cycles - cycles) / cycles if cycles else 0.0
+        writer.writerow([group, cost.instructions, cost.cycles, cycles,
+                         f"{error:.1f}"])
+        points.append((cost.cycles, cycles))
+
+    if len(points) < 2:
+        print("Not enough groups with both a trace and a measurement",
+              file=sys.stderr)
+        return
+    mean_error = sum(abs(estimated - cycles) / cycles
+                     for estimated, cycles in points if cycles) / len(points)
+    slope, offset, r_squared = linear_fit(points)
+    print(f"{len(points)} groups, mean absolute error "
+          f"{100 * mean_error:.1f}%", file=sys.stderr)
+    sign = "-" if offset < 0 else "+"
+    print(f"measured = {slope:.3f} * estimated {sign} {abs(offset):.0f} "
+          f"(R^2 {r_squared:.3f})", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Estimate Cortex-M4 cycles of instruction traces")
+    parser.add_argument("-o", "--output", type=Path,
+                        help="CSV to write, stdout by default")
+    parser.add_argument("--refill", type=int, default=cost_parameters.refill,
+                        help="Pipeline refill cycles of a taken branch")
+    parser.add_argument("--divide", type=int, default=cost_parameters.divide,
+                        help="Cycles of SDIV/UDIV")
+    parser.add_argument("-w", "--wait-states", type=int,
+                        default=cost_parameters.wait_states,
+                        help="Flash wait states of a fetch that misses the "
+                             "flash accelerator")
+    parser.add_argument("--flash-end", type=lambda value: int(value, 0),
+                        default=cost_parameters.flash_end,
+                        help="End of the flash address range")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    command = commands.add_parser("estimate",
+                                  help="Estimated cycles per function")
+    command.add_argument("elf", type=Path, help="ELF the trace was taken of")
+    command.add_argument("trace", type=Path)
+
+    command = commands.add_parser(
+        "validate", help="Compare per throw estimates with cycle_map")
+    command.add_argument("elf", type=Path, help="ELF the traces were taken of")
+    command.add_argument("traces", type=Path,
+                         help="Directory of throw_<n>.csv traces")
+    command.add_argument("measured", type=Path,
+                         help="CSV with group_index and cycles columns")
+    command.add_argument("--column", default="cycles",
+                         help="Column of the measured cycles")
+
+    args = parser.parse_args()
+    parameters = cost_parameters(args.refill, args.divide, args.wait_states,
+                                 args.flash_end)
+    elf = elf_file(args.elf)
+    output = args.output.open("w", newline="") if args.output else sys.stdout
+
+    if args.command == "estimate":
+        costs = estimate(elf, args.trace, parameters)
+        write_estimate(costs, output)
+        summary = total(costs)
+        cpi = summary.cycles / max(summary.instructions, 1)
+        print(f"{summary.instructions} instructions, {summary.cycles} "
+              f"cycles, CPI {cpi:.2f}", file=sys.stderr)
+    elif args.command == "validate":
+        validate(elf, args.traces, read_measured(args.measured, args.column),
+                 parameters, output)
+
+    if args.output:
+        output.close()
@@ -0,0 +1,305 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Minimal reader of the DWARF `.debug_line` section, versions 2 to 5.
+
+Only the line table rows are decoded, which is enough to tell which source
+line an instruction came from. Code inlined from another file, such as a
+header, is attributed to that file and not to the line that called it.
+"""
+
+import struct
+from dataclasses import dataclass
+from pathlib import PurePosixPath
+from typing import List, Optional, Tuple
+
+from elf_reader import elf_file
+
+DW_LNS_copy = 1
+DW_LNS_advance_pc = 2
+DW_LNS_advance_line = 3
+DW_LNS_set_file = 4
+DW_LNS_const_add_pc = 8
+DW_LNS_fixed_advance_pc = 9
+
+DW_LNE_end_sequence = 1
+DW_LNE_set_address = 2
+DW_LNE_define_file = 3
+
+DW_LNCT_path = 1
+DW_LNCT_directory_index = 2
+
+DW_FORM_block = 0x09
+DW_FORM_block1 = 0x0A
+DW_FORM_data1 = 0x0B
+DW_FORM_data2 = 0x05
+DW_FORM_data4 = 0x06
+DW_FORM_data8 = 0x07
+DW_FORM_data16 = 0x1E
+DW_FORM_line_strp = 0x1F
+DW_FORM_string = 0x08
+DW_FORM_strp = 0x0E
+DW_FORM_udata = 0x0F
+
+
+@dataclass
+class line_range:
+    """Instructions in [start, end) come from `line` of `file`"""
+    start: int
+    end: int
+    file: str
+    line: int
+
+
+def read_uleb128(data: bytes, offset: int) -> Tuple[int, int]:
+    result = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return result, offset
+
+
+def read_sleb128(data: bytes, offset: int) -> Tuple[int, int]:
+    result = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            if byte & 0x40:
+                result -= 1 << shift
+            return result, offset
+
+
+def read_string(data: bytes, offset: int) -> Tuple[str, int]:
+    end = data.index(b"\0", offset)
+    return data[offset:end].decode(errors="replace"), end + 1
+
+
+class line_table_reader:
+    def __init__(self, elf: elf_file):
+        self.elf = elf
+        self.strings = self._section_data(".debug_str")
+        self.line_strings = self._section_data(".debug_line_str")
+
+    def _section_data(self, name: str) -> bytes:
+        section = self.elf.section(name)
+        return self.elf.section_data(section) if section else b""
+
+    def _read_form(self, data: bytes, offset: int, form: int,
+                   offset_size: int) -> Tuple[object, int]:
+        if form == DW_FORM_string:
+            return read_string(data, offset)
+        if form in (DW_FORM_line_strp, DW_FORM_strp):
+            fmt = "<I" if offset_size == 4 else "<Q"
+            index = struct.unpack_from(fmt, data, offset)[0]
+            table = (self.line_strings if form == DW_FORM_line_strp
+                     else self.strings)
+            return read_string(table, index)[0], offset + offset_size
+        if form == DW_FORM_udata:
+            return read_uleb128(data, offset)
+        fixed = {DW_FORM_data1: 1, DW_FORM_data2: 2, DW_FORM_data4: 4,
+                 DW_FORM_data8: 8, DW_FORM_data16: 16}
+        if form in fixed:
+            size = fixed[form]
+            return (int.from_bytes(data[offset:offset + size], "little"),
+                    offset + size)
+        if form == DW_FORM_block:
+            length, offset = read_uleb128(data, offset)
+            return None, offset + length
+        if form == DW_FORM_block1:
+            return None, offset + 1 + data[offset]
+        raise ValueError(f"unsupported DW_FORM 0x{form:x} in .debug_line")
+
+    def _read_entries(self, data: bytes, offset: int,
+                      offset_size: int) -> Tuple[List[dict], int]:
+        """DWARF 5 directory or file name table"""
+        format_count = data[offset]
+        offset += 1
+        formats = []
+        for _ in range(format_count):
+            content, offset = read_uleb128(data, offset)
+            form, offset = read_uleb128(data, offset)
+            formats.append((content, form))
+        count, offset = read_uleb128(data, offset)
+        entries = []
+        for _ in range(count):
+            entry = {}
+            for content, form in formats:
+                entry[content], offset = self._read_form(data, offset, form,
+                                                         offset_size)
+            entries.append(entry)
+        return entries, offset
+
+    def ranges(self) -> List[line_range]:
+        section = self.elf.section(".debug_line")
+        if section is None:
+            return []
+        data = self.elf.section_data(section)
+        result: List[line_range] = []
+        offset = 0
+        while offset < len(data):
+            offset = self._read_unit(data, offset, result)
+        return result
+
+    def _read_unit(self, data: bytes, offset: int,
+                   result: List[line_range]) -> int:
+        offset_size = 4
+        unit_length = struct.unpack_from("<I", data, offset)[0]
+        offset += 4
+        if unit_length == 0xFFFFFFFF:
+            offset_size = 8
+            unit_length = struct.unpack_from("<Q", data, offset)[0]
+            offset += 8
+        unit_end = offset + unit_length
+
+        version = struct.unpack_from("<H", data, offset)[0]
+        offset += 2
+        if version >= 5:
+            offset += 2  # address_size, segment_selector_size
+        header_length = int.from_bytes(data[offset:offset + offset_size],
+                                       "little")
+        offset += offset_size
+        program_start = offset + header_length
+
+        minimum_instruction_length = data[offset]
+        offset += 1
+        if version >= 4:
+            offset += 1  # maximum_operations_per_instruction
+        offset += 1  # default_is_stmt
+        line_base = struct.unpack_from("<b", data, offset)[0]
+        line_range_size = data[offset + 1]
+        opcode_base = data[offset + 2]
+        standard_lengths = list(data[offset + 3:offset + 2 + opcode_base])
+        offset += 2 + opcode_base
+
+        if version >= 5:
+            directories, offset = self._read_entries(data, offset,
+                                                     offset_size)
+            entries, offset = self._read_entries(data, offset, offset_size)
+            directory_names = [entry.get(DW_LNCT_path, "")
+                               for entry in directories]
+            files = []
+            for entry in entries:
+                directory = entry.get(DW_LNCT_directory_index, 0)
+                files.append(self._join(directory_names, directory,
+                                        entry.get(DW_LNCT_path, "")))
+        else:
+            directory_names = [""]
+            while data[offset] != 0:
+                name, offset = read_string(data, offset)
+                directory_names.append(name)
+            offset += 1
+            # File numbers start at 1 before DWARF 5
+            files = [""]
+            while data[offset] != 0:
+                name, offset = read_string(data, offset)
+                directory, offset = read_uleb128(data, offset)
+                _, offset = read_uleb128(data, offset)
+                _, offset = read_uleb128(data, offset)
+                files.append(self._join(directory_names, directory, name))
+            offset += 1
+
+        self._run_program(data, program_start, unit_end, version, files,
+                          minimum_instruction_length, line_base,
+                          line_range_size, opcode_base, standard_lengths,
+                          result)
+        return unit_end
+
+    @staticmethod
+    def _join(directories: List[str], index: int, name: str) -> str:
+        if PurePosixPath(name).is_absolute() or index >= len(directories):
+            return name
+        return str(PurePosixPath(directories[index]) / name)
+
+    def _run_program(self, data: bytes, offset: int, end: int, version: int,
+                     files: List[str], minimum_instruction_length: int,
+                     line_base: int, line_range_size: int, opcode_base: int,
+                     standard_lengths: List[int],
+                     result: List[line_range]):
+        def reset():
+            # address, file, line
+            return 0, 1, 1
+
+        address, file, line = reset()
+        previous: Optional[Tuple[int, int, int]] = None
+
+        def emit(row_address: int):
+            nonlocal previous
+            if previous is not None and row_address > previous[0]:
+                previous_file = previous[1]
+                name = (files[previous_file]
+                        if previous_file < len(files) else "")
+                result.append(line_range(previous[0], row_address, name,
+                                         previous[2]))
+
+        while offset < end:
+            opcode = data[offset]
+            offset += 1
+            if opcode >= opcode_base:
+                adjusted = opcode - opcode_base
+                address += (adjusted // line_range_size *
+                            minimum_instruction_length)
+                line += line_base + adjusted % line_range_size
+                emit(address)
+                previous = (address, file, line)
+            elif opcode == 0:
+                length, offset = read_uleb128(data, offset)
+                sub_opcode = data[offset]
+                arguments = data[offset + 1:offset + length]
+                offset += length
+                if sub_opcode == DW_LNE_end_sequence:
+                    emit(address)
+                    previous = None
+                    address, file, line = reset()
+                elif sub_opcode == DW_LNE_set_address:
+                    address = int.from_bytes(arguments, "little")
+                elif sub_opcode == DW_LNE_define_file:
+                    name, _ = read_string(arguments, 0)
+                    files.append(name)
+            elif opcode == DW_LNS_copy:
+                emit(address)
+                previous = (address, file, line)
+            elif opcode == DW_LNS_advance_pc:
+                advance, offset = read_uleb128(data, offset)
+                address += advance * minimum_instruction_length
+            elif opcode == DW_LNS_advance_line:
+                advance, offset = read_sleb128(data, offset)
+                line += advance
+            elif opcode == DW_LNS_set_file:
+                file, offset = read_uleb128(data, offset)
+            elif opcode == DW_LNS_const_add_pc:
+                address += ((255 - opcode_base) // line_range_size *
+                            minimum_instruction_length)
+            elif opcode == DW_LNS_fixed_advance_pc:
+                address += struct.unpack_from("<H", data, offset)[0]
+                offset += 2
+            else:
+                # Every other standard opcode only takes uleb128 operands
+                for _ in range(standard_lengths[opcode - 1]):
+                    _, offset = read_uleb128(data, offset)
+
+
+def line_ranges(elf: elf_file) -> List[line_range]:
+    """Every address range of the line table, in table order"""
+    return line_table_reader(elf).ranges()
@@ -0,0 +1,136 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "seqlock.hpp"
+
+/// Number of return addresses the search_EIT_table cache holds, 0 disables it
+#if !defined(EIT_CACHE_SIZE)
+#define EIT_CACHE_SIZE 0
+#endif
+
+/// 1 for a direct mapped cache, 2 for a 2-way set associative cache
+#if !defined(EIT_CACHE_WAYS)
+#define EIT_CACHE_WAYS 1
+#endif
+
+/**
+ * @brief Cache of return address to exception index entry lookups
+ *
+ * Throws tend to repeat the same call chains and both unwind phases look up
+ * every frame, so most searches have been done before. Only successful
+ * lookups are cached, a nullptr from find() is always a miss.
+ *
+ * Tasks may look up and insert at once. Every line is a seqlock_line, so a
+ * line being written reads as a miss instead of a return address paired
+ * with another frame's entry.
+ *
+ * @tparam size - total number of entries, must be a multiple of ways and the
+ * number of sets must be a power of two. 0 disables the cache.
+ * @tparam ways - entries per set, 1 or 2. 2-way sets evict the least recently
+ * used entry.
+ */
+template<std::size_t size, std::size_t ways = 1>
+class eit_cache
+{
+public:
+  static_assert(ways == 1 || ways == 2, "Only direct mapped and 2-way");
+  static_assert(size % ways == 0, "size must be a multiple of ways");
+  static_assert(std::has_single_bit(size / ways) || size == 0,
+                "The number of sets must be a power of two");
+
+  [[gnu::always_inline]] const void* find(std::uint32_t p_return_address)
+  {
+    if constexpr (size == 0) {
+      return nullptr;
+    } else {
+      auto& set = m_sets[set_index(p_return_address)];
+      for (std::size_t way = 0; way < ways; way++) {
+        line candidate;
+        if (set.lines[way].load(candidate) &&
+            candidate.return_address == p_return_address) {
+          set.victim.store(static_cast<std::uint8_t>(way ^ 1),
+                           std::memory_order_relaxed);
+          hits.fetch_add(1, std::memory_order_relaxed);
+          return candidate.entry;
+        }
+      }
+      misses.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+  }
+
+  [[gnu::always_inline]] void insert(std::uint32_t p_return_address,
+                                     const void* p_entry)
+  {
+    if constexpr (size != 0) {
+      if (p_entry == nullptr) {
+        return;
+      }
+      auto& set = m_sets[set_index(p_return_address)];
+      std::size_t way =
+        (ways == 1) ? 0 : set.victim.load(std::memory_order_relaxed);
+      set.lines[way].store({ p_return_address, p_entry });
+      set.victim.store(static_cast<std::uint8_t>(way ^ 1),
+                       std::memory_order_relaxed);
+    }
+  }
+
+  /// Empties the cache, only while no task throws
+  void clear()
+  {
+    for (auto& set : m_sets) {
+      for (auto& line : set.lines) {
+        line.reset();
+      }
+      set.victim.store(0, std::memory_order_relaxed);
+    }
+    hits.store(0, std::memory_order_relaxed);
+    misses.store(0, std::memory_order_relaxed);
+  }
+
+  std::atomic<std::uint32_t> hits = 0;
+  std::atomic<std::uint32_t> misses = 0;
+
+private:
+  static constexpr std::size_t set_count = (size == 0) ? 1 : size / ways;
+
+  static std::size_t set_index(std::uint32_t p_return_address)
+  {
+    // Thumb instructions are at least 2 bytes apart
+    return (p_return_address >> 1) & (set_count - 1);
+  }
+
+  struct line
+  {
+    // 0 is never a return address, so zero initialized lines are empty
+    std::uint32_t return_address = 0;
+    const void* entry = nullptr;
+  };
+
+  struct set
+  {
+    std::array<seqlock_line<line>, ways> lines{};
+    std::atomic<std::uint8_t> victim = 0;
+  };
+
+  std::array<set, (size == 0) ? 0 : set_count> m_sets{};
+};
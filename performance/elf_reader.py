@@ -0,0 +1,194 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Minimal ELF reader used by the post-link tools in this directory.
+
+Only what the tools need is parsed: section headers, the symbol table and
+reading bytes by virtual address. Both ELF32 and ELF64 little endian files are
+supported so the same tools work on the ARM and host builds.
+"""
+
+import struct
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List, Optional
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+
+STT_NOTYPE = 0
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+@dataclass
+class elf_section:
+    index: int
+    name: str
+    type: int
+    flags: int
+    address: int
+    offset: int
+    size: int
+    link: int
+    info: int
+    entsize: int
+
+    def contains(self, address: int) -> bool:
+        return self.address <= address < self.address + self.size
+
+
+@dataclass
+class elf_symbol:
+    name: str
+    value: int
+    size: int
+    type: int
+    bind: int
+    section_index: int
+
+
+class elf_file:
+    def __init__(self, path: Path):
+        self.path = Path(path)
+        self.data = bytearray(self.path.read_bytes())
+
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        if self.data[5] != 1:
+            raise ValueError(f"{path} is not little endian")
+
+        self.is_64bit = self.data[4] == 2
+        if self.is_64bit:
+            header = struct.unpack_from("<HHIQQQIHHHHHH", self.data, 16)
+        else:
+            header = struct.unpack_from("<HHIIIIIHHHHHH", self.data, 16)
+        (_, self.machine, _, self.entry, _, section_offset, _, _, _, _,
+         section_entry_size, section_count, names_index) = header
+
+        self.sections = [self._read_section_header(
+            index, section_offset + index * section_entry_size)
+            for index in range(section_count)]
+
+        names = self.sections[names_index]
+        for section in self.sections:
+            section.name = self._read_string(names.offset, section.name)
+
+        self._symbols: Optional[List[elf_symbol]] = None
+        self._symbols_by_name: Optional[Dict[str, elf_symbol]] = None
+
+    def _read_section_header(self, index: int, offset: int) -> elf_section:
+        if self.is_64bit:
+            fields = struct.unpack_from("<IIQQQQIIQQ", self.data, offset)
+        else:
+            fields = struct.unpack_from("<IIIIIIIIII", self.data, offset)
+        (name, type, flags, address, file_offset, size, link, info, _,
+         entsize) = fields
+        # The name is resolved once the string table section is known
+        return elf_section(index, name, type, flags, address, file_offset,
+                           size, link, info, entsize)
+
+    def _read_string(self, table_offset: int, index: int) -> str:
+        start = table_offset + index
+        end = self.data.index(b"\0", start)
+        return self.data[start:end].decode()
+
+    def section(self, name: str) -> Optional[elf_section]:
+        for section in self.sections:
+            if section.name == name:
+                return section
+        return None
+
+    def section_at(self, address: int) -> Optional[elf_section]:
+        for section in self.sections:
+            if (section.flags & SHF_ALLOC and section.type != SHT_NOBITS and
+                    section.contains(address)):
+                return section
+        return None
+
+    def section_data(self, section: elf_section) -> bytes:
+        if section.type == SHT_NOBITS:
+            return bytes(section.size)
+        return bytes(self.data[section.offset:section.offset + section.size])
+
+    def symbols(self) -> List[elf_symbol]:
+        if self._symbols is not None:
+            return self._symbols
+
+        self._symbols = []
+        for table in self.sections:
+            if table.type != SHT_SYMTAB:
+                continue
+            strings = self.sections[table.link]
+            entry_format = "<IBBHQQ" if self.is_64bit else "<IIIBBH"
+            entry_size = struct.calcsize(entry_format)
+            for offset in range(table.offset, table.offset + table.size,
+                                entry_size):
+                fields = struct.unpack_from(entry_format, self.data, offset)
+                if self.is_64bit:
+                    name, info, _, shndx, value, size = fields
+                else:
+                    name, value, size, info, _, shndx = fields
+                self._symbols.append(elf_symbol(
+                    name=self._read_string(strings.offset, name),
+                    value=value, size=size, type=info & 0xF, bind=info >> 4,
+                    section_index=shndx))
+        return self._symbols
+
+    def symbol(self, name: str) -> Optional[elf_symbol]:
+        if self._symbols_by_name is None:
+            self._symbols_by_name = {}
+            for symbol in self.symbols():
+                self._symbols_by_name.setdefault(symbol.name, symbol)
+        return self._symbols_by_name.get(name)
+
+    def functions(self) -> List[elf_symbol]:
+        """Function symbols sorted by address, Thumb bit cleared"""
+        result = {}
+        for symbol in self.symbols():
+            if symbol.type == STT_FUNC and symbol.value != 0:
+                address = symbol.value & ~1
+                result.setdefault(address, elf_symbol(
+                    symbol.name, address, symbol.size, symbol.type,
+                    symbol.bind, symbol.section_index))
+        return sorted(result.values(), key=lambda symbol: symbol.value)
+
+    def file_offset(self, address: int) -> int:
+        section = self.section_at(address)
+        if section is None:
+            raise ValueError(f"0x{address:08x} is not backed by file data")
+        return section.offset + (address - section.address)
+
+    def read(self, address: int, size: int) -> bytes:
+        offset = self.file_offset(address)
+        return bytes(self.data[offset:offset + size])
+
+    def read_u32(self, address: int) -> int:
+        return struct.unpack("<I", self.read(address, 4))[0]
+
+    def write(self, address: int, payload: bytes):
+        """Overwrite bytes in place, call save() to write the file back"""
+        offset = self.file_offset(address)
+        self.data[offset:offset + len(payload)] = payload
+
+    def save(self):
+        self.path.write_bytes(self.data)
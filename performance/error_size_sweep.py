@@ -0,0 +1,238 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Builds and runs the generated groups once per `my_error_t` size and finds the
+call depth where throwing becomes cheaper than returning a `tl::expected`.
+
+For every size the benchmarks are generated with `generate.py --error_size`,
+built in `<build-dir>/size_<bytes>` and run. Their results are joined with
+`info.csv` into `<build-dir>/error_size_<bytes>.csv`, the same table
+`run_qemu.py` writes. `break_even.csv` has one row per size and destructor
+ratio:
+
+    error_size,ratio,depth
+
+`depth` is where `except.cycles` crosses `result.cycles`, interpolated
+between the two group depths around the crossing. A depth equal to the
+shallowest group means exceptions were already cheaper there, an empty one
+means they never were. `break_even.svg` plots it over the error size.
+
+Usage:
+
+    # Natively, with the host benchmarks
+    python3 error_size_sweep.py host
+
+    # Under QEMU, with the toolchain conan set up for the normal build
+    python3 error_size_sweep.py qemu \\
+        --toolchain build/MinSizeRel/generators/conan_toolchain.cmake
+"""
+
+import argparse
+import csv
+import subprocess
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional
+
+from run_qemu import merge, run
+
+PERFORMANCE_DIR = Path(__file__).resolve().parent
+DEFAULT_SIZES = [1, 2, 4, 8, 16, 32, 64, 96, 128, 256, 512]
+
+
+def configure_and_build(source: Path, build: Path, targets: List[str],
+                        definitions: List[str]):
+    subprocess.run(["cmake", "-S", str(source), "-B", str(build)] +
+                   [f"-D{definition}" for definition in definitions],
+                   check=True, stdout=subprocess.DEVNULL)
+    command = ["cmake", "--build", str(build), "-j"]
+    for target in targets:
+        command += ["--target", target]
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+
+
+def run_host(size: int, build: Path, timeout: int) -> tuple:
+    configure_and_build(PERFORMANCE_DIR / "host", build, [],
+                        ["CMAKE_BUILD_TYPE=Release",
+                         f"ERROR_TYPE_SIZE={size}"])
+    results = {}
+    for name in ["except", "result"]:
+        program = build / name
+        if not program.exists():
+            # result is skipped when tl-expected is missing
+            continue
+        subprocess.run([str(program)], cwd=build, timeout=timeout, check=True,
+                       stdout=subprocess.DEVNULL)
+        results[name] = build / f"{name}.csv"
+    return build / "info.csv", results
+
+
+def run_qemu(size: int, build: Path, toolchain: Path, qemu: str,
+             timeout: int) -> tuple:
+    sources = build / "src"
+    sources.mkdir(parents=True, exist_ok=True)
+    info = sources / "info.csv"
+    with info.open("w") as info_file:
+        subprocess.run([sys.executable, str(PERFORMANCE_DIR / "generate.py"),
+                        "--output_dir", str(sources),
+                        "--error_size", str(size)],
+                       stdout=info_file, check=True)
+
+    names = ["except", "result"]
+    configure_and_build(PERFORMANCE_DIR, build / "build",
+                        [f"{name}.qemu.elf" for name in names],
+                        [f"CMAKE_TOOLCHAIN_FILE={toolchain.resolve()}",
+                         "CMAKE_BUILD_TYPE=MinSizeRel",
+                         f"GENERATED_SOURCE_DIR={sources.resolve()}"])
+    results = {}
+    for name in names:
+        elf = build / "build" / f"{name}.qemu.elf"
+        results[name] = run(qemu, elf.resolve(), build, timeout)
+    return info, results
+
+
+def break_even(rows: List[Dict[str, str]]) -> Dict[str, Optional[float]]:
+    """Depth per destructor ratio where except.cycles <= result.cycles"""
+    by_ratio: Dict[str, List[tuple]] = {}
+    for row in rows:
+        if not row.get("except.cycles") or not row.get("result.cycles"):
+            continue
+        by_ratio.setdefault(row["ratio"], []).append(
+            (int(row["depth"]),
+             int(row["result.cycles"]) - int(row["except.cycles"])))
+
+    depths: Dict[str, Optional[float]] = {}
+    for ratio, points in by_ratio.items():
+        points.sort()
+        depths[ratio] = None
+        if points[0][1] >= 0:
+            depths[ratio] = float(points[0][0])
+            continue
+        for (depth, margin), (next_depth, next_margin) in zip(points,
+                                                              points[1:]):
+            if next_margin >= 0:
+                # margin < 0 <= next_margin
+                depths[ratio] = depth + (next_depth - depth) * (
+                    -margin / (next_margin - margin))
+                break
+    return depths
+
+
+def plot(table: Dict[int, Dict[str, Optional[float]]], output: Path):
+    """Break-even depth over the error size, one line per destructor ratio"""
+    width, height, margin = 640, 400, 60
+    sizes = sorted(table)
+    ratios = sorted({ratio for depths in table.values() for ratio in depths})
+    values = [depth for depths in table.values() for depth in depths.values()
+              if depth is not None]
+    top = max(values, default=1.0) * 1.1 or 1.0
+    colors = ["#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd",
+              "#8c564b"]
+
+    def x(index: int) -> float:
+        span = max(len(sizes) - 1, 1)
+        return margin + index * (width - 2 * margin) / span
+
+    def y(depth: float) -> float:
+        return height - margin - depth * (height - 2 * margin) / top
+
+    svg = [f'<svg xmlns="http://www.w3.org/2000/svg" width="{width}" '
+           f'height="{height}" font-family="sans-serif" font-size="11">',
+           f'<line x1="{margin}" y1="{height - margin}" '
+           f'x2="{width - margin}" y2="{height - margin}" stroke="black"/>',
+           f'<line x1="{margin}" y1="{margin}" x2="{margin}" '
+           f'y2="{height - margin}" stroke="black"/>',
+           f'<text x="{width / 2}" y="{height - 15}" text-anchor="middle">'
+           'my_error_t size (bytes)</text>',
+           f'<text x="15" y="{height / 2}" text-anchor="middle" '
+           f'transform="rotate(-90 15 {height / 2})">'
+           'break-even call depth</text>']
+    for index, size in enumerate(sizes):
+        svg.append(f'<text x="{x(index):.1f}" y="{height - margin + 15}" '
+                   f'text-anchor="middle">{size}</text>')
+    for tick in range(5):
+        depth = top * tick / 4
+        svg.append(f'<text x="{margin - 5}" y="{y(depth) + 4:.1f}" '
+                   f'text-anchor="end">{depth:.0f}</text>')
+
+    for number, ratio in enumerate(ratios):
+        color = colors[number % len(colors)]
+        points = [f"{x(index):.1f},{y(table[size][ratio]):.1f}"
+                  for index, size in enumerate(sizes)
+                  if table[size].get(ratio) is not None]
+        if points:
+            svg.append(f'<polyline points="{" ".join(points)}" fill="none" '
+                       f'stroke="{color}" stroke-width="2"/>')
+        svg.append(f'<text x="{width - margin + 5}" '
+                   f'y="{margin + 15 * number}" fill="{color}">'
+                   f'ratio {ratio}</text>')
+    svg.append("</svg>")
+    output.write_text("\n".join(svg) + "\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Run the generated groups for a range of my_error_t "
+                    "sizes and find where exceptions overtake tl::expected")
+    parser.add_argument("platform", choices=["host", "qemu"],
+                        help="'host' builds performance/host, 'qemu' builds "
+                             "the QEMU benchmarks of performance/")
+    parser.add_argument("-s", "--sizes", type=int, nargs="+",
+                        default=DEFAULT_SIZES,
+                        help="Error sizes in bytes")
+    parser.add_argument("-b", "--build-dir", type=Path,
+                        default=Path("build/error_size_sweep"),
+                        help="Directory for the builds and results")
+    parser.add_argument("--toolchain", type=Path,
+                        help="CMake toolchain file of the ARM build, "
+                             "required for qemu")
+    parser.add_argument("-q", "--qemu", default="qemu-system-arm",
+                        help="Path to qemu-system-arm")
+    parser.add_argument("-t", "--timeout", type=int, default=120,
+                        help="Seconds before a benchmark is considered hung")
+    args = parser.parse_args()
+
+    if args.platform == "qemu" and args.toolchain is None:
+        parser.error("qemu needs --toolchain")
+
+    args.build_dir.mkdir(parents=True, exist_ok=True)
+    table = {}
+    for size in args.sizes:
+        print(f"Error size {size} ...", file=sys.stderr)
+        build = args.build_dir / f"size_{size}"
+        if args.platform == "host":
+            info, results = run_host(size, build, args.timeout)
+        else:
+            info, results = run_qemu(size, build, args.toolchain, args.qemu,
+                                     args.timeout)
+
+        merged = args.build_dir / f"error_size_{size}.csv"
+        with merged.open("w", newline="") as output:
+            merge(info, results, output)
+        with merged.open() as merged_file:
+            table[size] = break_even(list(csv.DictReader(merged_file)))
+
+    with (args.build_dir / "break_even.csv").open("w", newline="") as output:
+        writer = csv.writer(output)
+        writer.writerow(["error_size", "ratio", "depth"])
+        for size, depths in table.items():
+            for ratio, depth in sorted(depths.items()):
+                writer.writerow([size, ratio,
+                                 "" if depth is None else f"{depth:.1f}"])
+
+    plot(table, args.build_dir / "break_even.svg")
+    print(args.build_dir / "break_even.csv")
@@ -12,119 +12,15 @@
 
 #include <unwind.h>
 
+#include "exception_allocator.hpp"
+#include "exception_globals.hpp"
+#include "platform.hpp"
+#include "statistics.hpp"
+
 volatile std::int32_t side_effect = 0;
 std::uint32_t start_cycles = 0;
 std::uint32_t end_cycles = 0;
 
-/// Structure type to access the Data Watch point and Trace Register (DWT).
-struct dwt_register_t
-{
-  /// Offset: 0x000 (R/W)  Control Register
-  volatile uint32_t ctrl;
-  /// Offset: 0x004 (R/W)  Cycle Count Register
-  volatile uint32_t cyccnt;
-  /// Offset: 0x008 (R/W)  CPI Count Register
-  volatile uint32_t cpicnt;
-  /// Offset: 0x00C (R/W)  Exception Overhead Count Register
-  volatile uint32_t exccnt;
-  /// Offset: 0x010 (R/W)  Sleep Count Register
-  volatile uint32_t sleepcnt;
-  /// Offset: 0x014 (R/W)  LSU Count Register
-  volatile uint32_t lsucnt;
-  /// Offset: 0x018 (R/W)  Folded-instruction Count Register
-  volatile uint32_t foldcnt;
-  /// Offset: 0x01C (R/ )  Program Counter Sample Register
-  volatile const uint32_t pcsr;
-  /// Offset: 0x020 (R/W)  Comparator Register 0
-  volatile uint32_t comp0;
-  /// Offset: 0x024 (R/W)  Mask Register 0
-  volatile uint32_t mask0;
-  /// Offset: 0x028 (R/W)  Function Register 0
-  volatile uint32_t function0;
-  /// Reserved 0
-  std::array<uint32_t, 1> reserved0;
-  /// Offset: 0x030 (R/W)  Comparator Register 1
-  volatile uint32_t comp1;
-  /// Offset: 0x034 (R/W)  Mask Register 1
-  volatile uint32_t mask1;
-  /// Offset: 0x038 (R/W)  Function Register 1
-  volatile uint32_t function1;
-  /// Reserved 1
-  std::array<uint32_t, 1> reserved1;
-  /// Offset: 0x040 (R/W)  Comparator Register 2
-  volatile uint32_t comp2;
-  /// Offset: 0x044 (R/W)  Mask Register 2
-  volatile uint32_t mask2;
-  /// Offset: 0x048 (R/W)  Function Register 2
-  volatile uint32_t function2;
-  /// Reserved 2
-  std::array<uint32_t, 1> reserved2;
-  /// Offset: 0x050 (R/W)  Comparator Register 3
-  volatile uint32_t comp3;
-  /// Offset: 0x054 (R/W)  Mask Register 3
-  volatile uint32_t mask3;
-  /// Offset: 0x058 (R/W)  Function Register 3
-  volatile uint32_t function3;
-};
-
-/// Structure type to access the Core Debug Register (CoreDebug)
-struct core_debug_registers_t
-{
-  /// Offset: 0x000 (R/W)  Debug Halting Control and Status Register
-  volatile uint32_t dhcsr;
-  /// Offset: 0x004 ( /W)  Debug Core Register Selector Register
-  volatile uint32_t dcrsr;
-  /// Offset: 0x008 (R/W)  Debug Core Register Data Register
-  volatile uint32_t dcrdr;
-  /// Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register
-  volatile uint32_t demcr;
-};
-
-/// Address of the hardware DWT registers
-constexpr intptr_t dwt_address = 0xE0001000UL;
-
-/// Address of the Cortex M CoreDebug module
-constexpr intptr_t core_debug_address = 0xE000EDF0UL;
-
-// NOLINTNEXTLINE
-auto* dwt = reinterpret_cast<dwt_register_t*>(dwt_address);
-
-// NOLINTNEXTLINE
-auto* core = reinterpret_cast<core_debug_registers_t*>(core_debug_address);
-
-void
-dwt_counter_enable()
-{
-  /**
-   * @brief This bit must be set to 1 to enable use of the trace and debug
-   * blocks:
-   *
-   *   - Data Watchpoint and Trace (DWT)
-   *   - Instrumentation Trace Macrocell (ITM)
-   *   - Embedded Trace Macrocell (ETM)
-   *   - Trace Port Interface Unit (TPIU).
-   */
-  constexpr unsigned core_trace_enable = 1 << 24U;
-
-  /// Mask for turning on cycle counter.
-  constexpr unsigned enable_cycle_count = 1 << 0;
-
-  // Enable trace core
-  core->demcr = (core->demcr | core_trace_enable);
-
-  // Reset cycle count
-  dwt->cyccnt = 0;
-
-  // Start cycle count
-  dwt->ctrl = (dwt->ctrl | enable_cycle_count);
-}
-
-std::uint32_t
-uptime()
-{
-  return dwt->cyccnt;
-}
-
 struct my_error_t
 {
   std::array<std::uint8_t, 4> data;
@@ -133,9 +29,7 @@ struct my_error_t
 [[noreturn]] void
 terminate() noexcept
 {
-  while (true) {
-    continue;
-  }
+  benchmark_halt();
 }
 
 namespace __cxxabiv1 {                                  // NOLINT
@@ -146,9 +40,7 @@ extern "C"
 {
   void _exit([[maybe_unused]] int rc)
   {
-    while (true) {
-      continue;
-    }
+    benchmark_halt();
   }
   int kill(int, int)
   {
@@ -160,29 +52,32 @@ extern "C"
     return 1;
   }
 
-  std::array<std::uint8_t, 1024> storage;
-  std::span<std::uint8_t> storage_left(storage);
+  exception_allocator<EXCEPTION_POOL_SIZE> exception_pool;
   void* __wrap___cxa_allocate_exception(unsigned int p_size) // NOLINT
   {
-    // I only know this needs to be 128 because of the disassembly. I cannot
-    // figure out why its needed yet, but maybe the answer is in the
-    // libunwind-arm.cpp file.
-    static constexpr size_t offset = 128;
-    if (p_size + offset > storage_left.size()) {
-      return nullptr;
+    auto* memory = exception_pool.allocate(p_size);
+    if (memory == nullptr) {
+      // Same as libsupc++ once its emergency pool is exhausted
+      std::terminate();
     }
-    auto* memory = &storage_left[offset];
-    storage_left = storage_left.subspan(p_size + offset);
     return memory;
   }
-  void __wrap___cxa_free_exception(void*) // NOLINT
+  void __wrap___cxa_free_exception(void* p_thrown_object) // NOLINT
   {
-    storage_left = std::span<std::uint8_t>(storage);
+    exception_pool.free(p_thrown_object);
   }
   void __wrap___cxa_call_unexpected(void*) // NOLINT
   {
     std::terminate();
   }
+  void* __wrap___cxa_get_globals() // NOLINT
+  {
+    return exception_globals_hook();
+  }
+  void* __wrap___cxa_get_globals_fast() // NOLINT
+  {
+    return exception_globals_hook();
+  }
 } // extern "C"
 
 int
@@ -192,8 +87,7 @@ int
 main()
 {
   dwt_counter_enable();
-  // Set flash accelerator to 1 CPU cycle per instruction
-  *reinterpret_cast<std::uint32_t*>(0x400F'C000) = 0xA;
+  enable_flash_accelerator();
   volatile int return_code = 0;
   try {
     return_code = start();
@@ -204,7 +98,12 @@ main()
   return return_code;
 }
 
+constexpr std::size_t trial_count = 100;
 std::array<std::uint64_t, 25> cycle_map{};
+std::array<cycle_statistics, 25> cycle_stats{};
+std::array<std::array<std::uint32_t, trial_count>, 25> trial_cycles{};
+std::array<std::uint64_t, 25> stack_map{};
+std::array<std::uint64_t, 25> happy_cycle_map{};
 
 int
 funct_group0_0();
@@ -271,29 +170,69 @@ std::array<signature*, 25> functions = {
 
 std::uint64_t iterate_start = 0;
 std::uint64_t iterate_end = 0;
-std::uint64_t call_latency = 0;
 
 int
 start()
 {
   cycle_map.fill(0);
-  auto call_latency_test_start = uptime();
-  auto call_latency_test_end = uptime();
-  call_latency = call_latency_test_end - call_latency_test_start;
-
-  std::uint32_t index = 0;
-
+  measure_call_latency();
+
+  // Round robin over the groups so every trial sees the same sequence of
+  // throws as a single pass would.
+  for (std::size_t trial = 0; trial < trial_count; trial++) {
+    std::uint32_t index = 0;
+    for (auto& funct : functions) {
+      try {
+        start_cycles = uptime();
+        funct();
+      } catch ([[maybe_unused]] const my_error_t& p_error) {
+        end_cycles = uptime();
+        trial_cycles[index][trial] = elapsed_cycles(start_cycles, end_cycles);
+      }
+      index++;
+    }
+  }
 
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    cycle_stats[index] = summarize(trial_cycles[index]);
+    cycle_map[index] = cycle_stats[index].median;
+  }
 
-  for (auto& funct : functions) {
+  // Deepest stack each throw and catch reaches, unwinder included
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    stack_paint();
+    auto stack_reference = stack_pointer();
     try {
+      functions[index]();
+    } catch ([[maybe_unused]] const my_error_t& p_error) {
+    }
+    stack_map[index] = stack_usage(stack_reference);
+  }
+
+  // Round robin over the groups so every trial sees the same sequence of
+  // calls as a single pass would.
+  for (std::size_t trial = 0; trial < trial_count; trial++) {
+    std::uint32_t index = 0;
+    for (auto& funct : functions) {
+      side_effect = -1'000'000'000;
       start_cycles = uptime();
       funct();
-    } catch ([[maybe_unused]] const my_error_t& p_error) {
       end_cycles = uptime();
-      cycle_map[index++] = end_cycles - start_cycles;
+      trial_cycles[index][trial] = elapsed_cycles(start_cycles, end_cycles);
+      index++;
     }
   }
+
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    happy_cycle_map[index] = summarize(trial_cycles[index]).median;
+  }
+
+  export_csv(
+    "group_index,cycles,stack_bytes,happy_cycles,min,median,mean,max,p99",
+    cycle_map,
+    stack_map,
+    happy_cycle_map,
+    cycle_stats);
   return side_effect;
 }
 
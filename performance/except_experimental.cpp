@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
@@ -11,119 +12,19 @@
 #include <span>
 #include <string_view>
 
+#include "eit_cache.hpp"
+#include "exidx_search.hpp"
+#include "exception_allocator.hpp"
+#include "exception_globals.hpp"
+#include "gxx_personality.hpp"
+#include "platform.hpp"
+#include "statistics.hpp"
+#include "unwind_record.hpp"
+
 volatile std::int32_t side_effect = 0;
 std::uint32_t start_cycles = 0;
 std::uint32_t end_cycles = 0;
 
-/// Structure type to access the Data Watch point and Trace Register (DWT).
-struct dwt_register_t
-{
-  /// Offset: 0x000 (R/W)  Control Register
-  volatile uint32_t ctrl;
-  /// Offset: 0x004 (R/W)  Cycle Count Register
-  volatile uint32_t cyccnt;
-  /// Offset: 0x008 (R/W)  CPI Count Register
-  volatile uint32_t cpicnt;
-  /// Offset: 0x00C (R/W)  Exception Overhead Count Register
-  volatile uint32_t exccnt;
-  /// Offset: 0x010 (R/W)  Sleep Count Register
-  volatile uint32_t sleepcnt;
-  /// Offset: 0x014 (R/W)  LSU Count Register
-  volatile uint32_t lsucnt;
-  /// Offset: 0x018 (R/W)  Folded-instruction Count Register
-  volatile uint32_t foldcnt;
-  /// Offset: 0x01C (R/ )  Program Counter Sample Register
-  volatile const uint32_t pcsr;
-  /// Offset: 0x020 (R/W)  Comparator Register 0
-  volatile uint32_t comp0;
-  /// Offset: 0x024 (R/W)  Mask Register 0
-  volatile uint32_t mask0;
-  /// Offset: 0x028 (R/W)  Function Register 0
-  volatile uint32_t function0;
-  /// Reserved 0
-  std::array<uint32_t, 1> reserved0;
-  /// Offset: 0x030 (R/W)  Comparator Register 1
-  volatile uint32_t comp1;
-  /// Offset: 0x034 (R/W)  Mask Register 1
-  volatile uint32_t mask1;
-  /// Offset: 0x038 (R/W)  Function Register 1
-  volatile uint32_t function1;
-  /// Reserved 1
-  std::array<uint32_t, 1> reserved1;
-  /// Offset: 0x040 (R/W)  Comparator Register 2
-  volatile uint32_t comp2;
-  /// Offset: 0x044 (R/W)  Mask Register 2
-  volatile uint32_t mask2;
-  /// Offset: 0x048 (R/W)  Function Register 2
-  volatile uint32_t function2;
-  /// Reserved 2
-  std::array<uint32_t, 1> reserved2;
-  /// Offset: 0x050 (R/W)  Comparator Register 3
-  volatile uint32_t comp3;
-  /// Offset: 0x054 (R/W)  Mask Register 3
-  volatile uint32_t mask3;
-  /// Offset: 0x058 (R/W)  Function Register 3
-  volatile uint32_t function3;
-};
-
-/// Structure type to access the Core Debug Register (CoreDebug)
-struct core_debug_registers_t
-{
-  /// Offset: 0x000 (R/W)  Debug Halting Control and Status Register
-  volatile uint32_t dhcsr;
-  /// Offset: 0x004 ( /W)  Debug Core Register Selector Register
-  volatile uint32_t dcrsr;
-  /// Offset: 0x008 (R/W)  Debug Core Register Data Register
-  volatile uint32_t dcrdr;
-  /// Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register
-  volatile uint32_t demcr;
-};
-
-/// Address of the hardware DWT registers
-constexpr intptr_t dwt_address = 0xE0001000UL;
-
-/// Address of the Cortex M CoreDebug module
-constexpr intptr_t core_debug_address = 0xE000EDF0UL;
-
-// NOLINTNEXTLINE
-auto* dwt = reinterpret_cast<dwt_register_t*>(dwt_address);
-
-// NOLINTNEXTLINE
-auto* core = reinterpret_cast<core_debug_registers_t*>(core_debug_address);
-
-void
-dwt_counter_enable()
-{
-  /**
-   * @brief This bit must be set to 1 to enable use of the trace and debug
-   * blocks:
-   *
-   *   - Data Watchpoint and Trace (DWT)
-   *   - Instrumentation Trace Macrocell (ITM)
-   *   - Embedded Trace Macrocell (ETM)
-   *   - Trace Port Interface Unit (TPIU).
-   */
-  constexpr unsigned core_trace_enable = 1 << 24U;
-
-  /// Mask for turning on cycle counter.
-  constexpr unsigned enable_cycle_count = 1 << 0;
-
-  // Enable trace core
-  core->demcr = (core->demcr | core_trace_enable);
-
-  // Reset cycle count
-  dwt->cyccnt = 0;
-
-  // Start cycle count
-  dwt->ctrl = (dwt->ctrl | enable_cycle_count);
-}
-
-std::uint32_t
-uptime()
-{
-  return dwt->cyccnt;
-}
-
 struct my_error_t
 {
   std::array<std::uint8_t, 4> data;
@@ -132,9 +33,7 @@ struct my_error_t
 [[noreturn]] void
 terminate() noexcept
 {
-  while (true) {
-    continue;
-  }
+  benchmark_halt();
 }
 
 namespace __cxxabiv1 {                                  // NOLINT
@@ -145,9 +44,7 @@ extern "C"
 {
   void _exit([[maybe_unused]] int rc)
   {
-    while (true) {
-      continue;
-    }
+    benchmark_halt();
   }
   int kill(int, int)
   {
@@ -159,52 +56,35 @@ extern "C"
     return 1;
   }
 
-  std::array<std::uint8_t, 1024> storage;
-  std::span<std::uint8_t> storage_left(storage);
+  exception_allocator<EXCEPTION_POOL_SIZE> exception_pool;
   void* __wrap___cxa_allocate_exception(unsigned int p_size) // NOLINT
   {
-    // I only know this needs to be 128 because of the disassembly. I cannot
-    // figure out why its needed yet, but maybe the answer is in the
-    // libunwind-arm.cpp file.
-    static constexpr size_t offset = 128;
-    if (p_size + offset > storage_left.size()) {
-      return nullptr;
+    auto* memory = exception_pool.allocate(p_size);
+    if (memory == nullptr) {
+      // Same as libsupc++ once its emergency pool is exhausted
+      std::terminate();
     }
-    auto* memory = &storage_left[offset];
-    storage_left = storage_left.subspan(p_size + offset);
     return memory;
   }
-  void __wrap___cxa_free_exception(void*) // NOLINT
+  void __wrap___cxa_free_exception(void* p_thrown_object) // NOLINT
   {
-    storage_left = std::span<std::uint8_t>(storage);
+    exception_pool.free(p_thrown_object);
   }
   void __wrap___cxa_call_unexpected(void*) // NOLINT
   {
     std::terminate();
   }
-#define USE_KHALIL_EXCEPTIONS 1
-
-#if USE_KHALIL_EXCEPTIONS == 1
-  typedef struct __EIT_entry
+  void* __wrap___cxa_get_globals() // NOLINT
   {
-    std::uint32_t fnoffset;
-    std::uint32_t content;
-  } __EIT_entry;
-
-  std::uint32_t selfrel_offset31(const std::uint32_t* p)
+    return exception_globals_hook();
+  }
+  void* __wrap___cxa_get_globals_fast() // NOLINT
   {
-    std::uint32_t offset;
-
-    offset = *p;
-    /* Sign extend to 32 bits.  */
-    if (offset & (1 << 30))
-      offset |= 1u << 31;
-    else
-      offset &= ~(1u << 31);
-
-    return offset + (std::uint32_t)p;
+    return exception_globals_hook();
   }
+#define USE_KHALIL_EXCEPTIONS 1
 
+#if USE_KHALIL_EXCEPTIONS == 1
   extern std::uint32_t __trivial_handle_start;
   extern std::uint32_t __trivial_handle_end;
   extern std::uint32_t __text_start;
@@ -215,113 +95,142 @@ extern "C"
   {
     // NOLINTNEXTLINE
     std::uint32_t* check = reinterpret_cast<std::uint32_t*>(return_address);
-    return &__trivial_handle_start <= check && check <= &__trivial_handle_end;
+    return &__trivial_handle_start <= check && check < &__trivial_handle_end;
   }
 
-  struct eit_entry_less_than
+  // Switched by start() to compare the trivial slice search against the
+  // search of the whole table
+  std::atomic<bool> trivial_lookup_enabled = false;
+  std::atomic<std::uint32_t> trivial_lookups = 0;
+
+  /* .ARM.exidx is sorted by function, so the entries of the functions
+     between __trivial_handle_start and __trivial_handle_end are one slice of
+     the table. Unlike returning one shared entry, this holds for any number
+     of functions with different unwind instructions. The linker merges equal
+     neighbouring entries, an entry that starts before the slice is not in it
+     and its lookups fall back to the whole table. Found on the first throw
+     that needs it, tasks that race here find the same slice.  */
+  std::atomic<bool> trivial_slice_found = false;
+  std::atomic<std::uint32_t> trivial_slice_first = 0;
+  std::atomic<std::uint32_t> trivial_slice_count = 0;
+
+  /// Index of the first entry whose function starts at or after p_address
+  inline std::uint32_t first_entry_from(const __EIT_entry* table,
+                                        int nrec, // NOLINT
+                                        std::uint32_t p_address)
   {
-    [[gnu::always_inline]] static std::uint32_t to_prel31_offset(
-      const __EIT_entry& entry,
-      std::uint32_t address)
-    {
-      std::uint32_t entry_addr = reinterpret_cast<std::uint32_t>(&entry);
-      std::uint32_t final_address = (address - entry_addr) & ~(1 << 31);
-      return final_address;
+    std::uint32_t low = 0;
+    std::uint32_t high = static_cast<std::uint32_t>(nrec);
+    while (low < high) {
+      auto middle = (low + high) / 2;
+      if (selfrel_offset31(&table[middle].fnoffset) < p_address) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
     }
+    return low;
+  }
 
-    bool operator()(const __EIT_entry& left, const __EIT_entry& right)
-    {
-      return left.fnoffset < right.fnoffset;
-    }
-    bool operator()(const __EIT_entry& left, std::uint32_t right)
-    {
-      std::uint32_t final_address = to_prel31_offset(left, right);
-      return left.fnoffset < final_address;
+  /// Searches only the entries of the trivial functions, see above
+  [[gnu::always_inline]] inline const __EIT_entry* search_trivial_slice(
+    const __EIT_entry* table,
+    int nrec, // NOLINT
+    std::uint32_t return_address)
+  {
+    if (!trivial_slice_found.load(std::memory_order_acquire)) {
+      auto first = first_entry_from(
+        table, nrec, reinterpret_cast<std::uint32_t>(&__trivial_handle_start));
+      auto end = first_entry_from(
+        table, nrec, reinterpret_cast<std::uint32_t>(&__trivial_handle_end));
+      trivial_slice_first.store(first, std::memory_order_relaxed);
+      trivial_slice_count.store(end - first, std::memory_order_relaxed);
+      trivial_slice_found.store(true, std::memory_order_release);
     }
-    bool operator()(std::uint32_t left, const __EIT_entry& right)
-    {
-      std::uint32_t final_address = to_prel31_offset(right, left);
-      return final_address < right.fnoffset;
+    auto count = trivial_slice_count.load(std::memory_order_relaxed);
+    if (count == 0) {
+      return nullptr;
     }
-  };
+    trivial_lookups.fetch_add(1, std::memory_order_relaxed);
+    return search_prel31_table(
+      table + trivial_slice_first.load(std::memory_order_relaxed),
+      static_cast<int>(count), // NOLINT
+      return_address);
+  }
+
+  extern const exidx_index_header __exidx_index_start;
+
   std::uint32_t upper_bound_cycles = 0;
-  // NOLINTNEXTLINE
-  const __EIT_entry* search_EIT_table(const __EIT_entry* table,
-                                      int nrec, // NOLINT
-                                      std::uint32_t return_address)
+  [[gnu::always_inline]] inline const __EIT_entry* lookup_EIT_table(
+    const __EIT_entry* table,
+    int nrec, // NOLINT
+    std::uint32_t return_address)
   {
     if (nrec == 0) {
       return nullptr;
     }
-#if 0
-    if (is_trivial_function(return_address)) {
-      return &table[nrec - 2];
+    if (trivial_lookup_enabled.load(std::memory_order_relaxed) &&
+        is_trivial_function(return_address)) {
+      if (const auto* entry =
+            search_trivial_slice(table, nrec, return_address)) {
+        return entry;
+      }
     }
-#endif
 #define SEARCH_ALGORITHM 0
 #if SEARCH_ALGORITHM == 0
-    int left = 0;
-    int right = nrec - 1;
-    while (true) {
-      int n = (left + right) / 2;
-      std::uint32_t next_fn = std::numeric_limits<std::uint32_t>::max();
-      std::uint32_t this_fn = selfrel_offset31(&table[n].fnoffset);
-
-      if (n != nrec - 1) {
-        next_fn = selfrel_offset31(&table[n + 1].fnoffset) - 1;
-      }
-
-      if (return_address < this_fn) {
-        if (n == left) {
-          return nullptr;
-        }
-        right = n - 1;
-      } else if (return_address <= next_fn) {
-        return &table[n];
-      } else {
-        left = n + 1;
-      }
-    }
+    return search_prel31_table(table, nrec, return_address);
 #elif SEARCH_ALGORITHM == 1
-    int left = 0;
-    int right = nrec - 1;
-
-    while (true) {
-      int n = (left + right) / 2;
-      std::uint32_t next_fn = std::numeric_limits<std::uint32_t>::max();
-      std::uint32_t this_fn = table[n].fnoffset;
-
-      if (n != nrec - 1) {
-        next_fn = table[n + 1].fnoffset - 1;
-      }
-
-      std::uint32_t prel31 =
-        return_address - reinterpret_cast<std::uint32_t>(&table[n]);
-      // clear MSB to conform to the prel31 fnoffset format
-      prel31 = prel31 & ~(1 << 31);
-
-      if (prel31 < this_fn) {
-        if (n == left) {
-          return nullptr;
-        }
-        right = n - 1;
-      } else if (prel31 <= next_fn) {
-        return &table[n];
-      } else {
-        left = n + 1;
-      }
-    }
+    return search_prel31_relative(table, nrec, return_address);
 #elif SEARCH_ALGORITHM == 2
     auto new_start_cycles = uptime();
-    std::span<const __EIT_entry> table_span(table, nrec);
-    const auto& entry = std::upper_bound(table_span.begin(),
-                                         table_span.end(),
-                                         return_address,
-                                         eit_entry_less_than{});
+    auto* entry = search_upper_bound(table, nrec, return_address);
     auto new_end_cycles = uptime();
     upper_bound_cycles = new_end_cycles - new_start_cycles;
-    return &(*(entry - 1));
+    return entry;
+#elif SEARCH_ALGORITHM == 3 || SEARCH_ALGORITHM == 4
+    // Search the absolute function start addresses that exidx_index.py
+    // wrote into .exidx_index, no prel31 decoding per probe. 3 is a binary
+    // search over the sorted or compact layout, 4 is the branchless search
+    // over the eytzinger layout.
+#define EXIDX_INDEX_COMPACT 0
+    const auto& index = __exidx_index_start;
+#if SEARCH_ALGORITHM == 4
+    constexpr auto layout = exidx_index_eytzinger;
+#elif EXIDX_INDEX_COMPACT
+    constexpr auto layout = exidx_index_compact;
+#else
+    constexpr auto layout = exidx_index_sorted;
 #endif
+    if (index.layout != layout ||
+        index.count != static_cast<std::uint32_t>(nrec)) {
+      // exidx_index.py has not been run on this image, or was run with a
+      // different layout.
+      return search_prel31_table(table, nrec, return_address);
+    }
+#if SEARCH_ALGORITHM == 4
+    return search_eytzinger_index(table, index, return_address);
+#elif EXIDX_INDEX_COMPACT
+    return search_compact_index(table, index, return_address);
+#else
+    return search_sorted_index(table, index, return_address);
+#endif
+#endif
+  }
+
+  eit_cache<EIT_CACHE_SIZE, EIT_CACHE_WAYS> eit_lookup_cache;
+
+  // NOLINTNEXTLINE
+  const __EIT_entry* search_EIT_table(const __EIT_entry* table,
+                                      int nrec, // NOLINT
+                                      std::uint32_t return_address)
+  {
+    const auto* entry =
+      static_cast<const __EIT_entry*>(eit_lookup_cache.find(return_address));
+    if (entry == nullptr) {
+      entry = lookup_EIT_table(table, nrec, return_address);
+      eit_lookup_cache.insert(return_address, entry);
+    }
+    return entry;
   }
 
 /* Misc constants.  */
@@ -478,10 +387,104 @@ extern "C"
     return _UVRSR_OK;
   }
 
+  extern const __EIT_entry __exidx_start;
+  extern const __EIT_entry __exidx_end;
+  extern const unwind_records_header __unwind_records_start;
+
+  // Switched by start() to compare the records against the bytecode
+  std::atomic<bool> unwind_records_enabled = false;
+  std::atomic<std::uint32_t> unwind_record_frames = 0;
+  std::atomic<std::uint32_t> unwind_bytecode_frames = 0;
+
+  /* The exception index entry of the frame whose bytecode uws reads. It is
+     worked out from the frame itself, __gnu_unwind_execute is also reached
+     from _Unwind_Resume, and a throw inside a cleanup or from another task
+     may have looked up other frames since.  */
+  [[gnu::always_inline]] inline const __EIT_entry* frame_eit_entry(
+    _Unwind_Context* context,
+    const __gnu_unwind_state* uws)
+  {
+    const auto* table = &__exidx_start;
+    const auto* table_end = &__exidx_end;
+    /* Compact entries keep their bytecode in the index itself, the
+       personality routine leaves next pointing at the following entry.  */
+    const auto* next = reinterpret_cast<const std::uint8_t*>(uws->next);
+    const auto* first = reinterpret_cast<const std::uint8_t*>(table);
+    const auto* last = reinterpret_cast<const std::uint8_t*>(table_end);
+    if (first < next && next <= last &&
+        (next - first) % sizeof(__EIT_entry) == 0) {
+      return reinterpret_cast<const __EIT_entry*>(next) - 1;
+    }
+    /* The bytecode is in .ARM.extab, find the entry of the frame's pc. It is
+       still the call site the unwinder looked up, or the one _Unwind_Resume
+       restored.  */
+    _uw pc = 0;
+    _My_Unwind_VRS_Get(context, _UVRSC_CORE, R_PC, _UVRSD_UINT32, &pc);
+    return search_EIT_table(table, table_end - table, pc - 2);
+  }
+
+  /// The record of the frame being unwound, nullptr if it has to be
+  /// interpreted
+  [[gnu::always_inline]] inline const unwind_record* find_unwind_record(
+    _Unwind_Context* context,
+    const __gnu_unwind_state* uws)
+  {
+    const auto& header = __unwind_records_start;
+    if (!unwind_records_enabled || header.format != unwind_records_format ||
+        header.count !=
+          static_cast<std::uint32_t>(&__exidx_end - &__exidx_start)) {
+      // unwind_records.py has not been run on this image
+      return nullptr;
+    }
+    const auto* entry = frame_eit_entry(context, uws);
+    if (entry == nullptr) {
+      return nullptr;
+    }
+    const auto* records = reinterpret_cast<const unwind_record*>(&header + 1);
+    const auto& record = records[entry - &__exidx_start];
+    if ((record.flags & unwind_record_fast) == 0) {
+      return nullptr;
+    }
+    return &record;
+  }
+
+  [[gnu::always_inline]] inline void apply_unwind_record(
+    _Unwind_Context* context,
+    const unwind_record& record)
+  {
+    auto* vrs = reinterpret_cast<phase1_vrs*>(context);
+    if (record.vsp_register != R_SP) {
+      vrs->core.r[R_SP] = vrs->core.r[record.vsp_register];
+    }
+    vrs->core.r[R_SP] += record.sp_words * 4u;
+    if (record.vfp_count != 0) {
+      _Unwind_VRS_Pop(context,
+                      _UVRSC_VFP,
+                      (record.vfp_first << 16) | record.vfp_count,
+                      _UVRSD_DOUBLE);
+    }
+    if (record.core_mask != 0) {
+      _Unwind_VRS_Pop(context, _UVRSC_CORE, record.core_mask, _UVRSD_UINT32);
+    }
+    vrs->core.r[R_SP] += record.sp_words_after * 4u;
+    if ((record.core_mask & (1 << R_PC)) == 0) {
+      vrs->core.r[R_PC] = vrs->core.r[R_LR];
+    }
+  }
+
   /* Execute the unwinding instructions described by UWS.  */
   _Unwind_Reason_Code __gnu_unwind_execute(_Unwind_Context* context,
                                            __gnu_unwind_state* uws)
   {
+#if UNWIND_RECORDS
+    if (const auto* record = find_unwind_record(context, uws)) {
+      unwind_record_frames.fetch_add(1, std::memory_order_relaxed);
+      apply_unwind_record(context, *record);
+      return _URC_OK;
+    }
+#endif
+    unwind_bytecode_frames.fetch_add(1, std::memory_order_relaxed);
+
     _uw op;
     int set_pc;
     _uw reg;
@@ -660,6 +663,126 @@ extern "C"
     }
     return _URC_OK;
   }
+
+  _Unwind_Reason_Code __aeabi_unwind_cpp_pr0(_Unwind_State,
+                                             _Unwind_Control_Block*,
+                                             _Unwind_Context*);
+  _Unwind_Reason_Code __aeabi_unwind_cpp_pr1(_Unwind_State,
+                                             _Unwind_Control_Block*,
+                                             _Unwind_Context*);
+  _Unwind_Reason_Code __aeabi_unwind_cpp_pr2(_Unwind_State,
+                                             _Unwind_Control_Block*,
+                                             _Unwind_Context*);
+  [[noreturn]] void __restore_core_regs(core_regs* p_core); // NOLINT
+
+#define EXIDX_CANTUNWIND 1
+#define UCB_FORCED_STOP_FN(ucbp) ((ucbp)->unwinder_cache.reserved1)
+#define UCB_PR_ADDR(ucbp) ((ucbp)->unwinder_cache.reserved2)
+#define UCB_SAVED_CALLSITE_ADDR(ucbp) ((ucbp)->unwinder_cache.reserved3)
+
+  /* libgcc's get_eit_entry. Find the exception index entry of the frame and
+     its personality routine.  */
+  [[gnu::always_inline]] inline _Unwind_Reason_Code find_eit_entry(
+    _Unwind_Control_Block* ucbp,
+    std::uint32_t return_address)
+  {
+    /* The return address may be the first instruction of the next
+       function, point it into the call instruction.  */
+    return_address -= 2;
+    const auto* eitp = search_EIT_table(
+      &__exidx_start, &__exidx_end - &__exidx_start, return_address);
+    if (eitp == nullptr) {
+      UCB_PR_ADDR(ucbp) = 0;
+      return _URC_FAILURE;
+    }
+    ucbp->pr_cache.fnstart = selfrel_offset31(&eitp->fnoffset);
+
+    if (eitp->content == EXIDX_CANTUNWIND) {
+      UCB_PR_ADDR(ucbp) = 0;
+      return _URC_END_OF_STACK;
+    }
+
+    if (eitp->content & (1u << 31)) {
+      /* It is immediate data.  */
+      ucbp->pr_cache.ehtp = const_cast<_Unwind_EHT_Header*>(&eitp->content);
+      ucbp->pr_cache.additional = 1;
+    } else {
+      ucbp->pr_cache.ehtp = reinterpret_cast<_Unwind_EHT_Header*>(
+        selfrel_offset31(&eitp->content));
+      ucbp->pr_cache.additional = 0;
+    }
+
+    if (*ucbp->pr_cache.ehtp & (1u << 31)) {
+      /* One of the predefined standard routines.  */
+      switch ((*ucbp->pr_cache.ehtp >> 24) & 0xf) {
+        case 0:
+          UCB_PR_ADDR(ucbp) = reinterpret_cast<_uw>(&__aeabi_unwind_cpp_pr0);
+          break;
+        case 1:
+          UCB_PR_ADDR(ucbp) = reinterpret_cast<_uw>(&__aeabi_unwind_cpp_pr1);
+          break;
+        case 2:
+          UCB_PR_ADDR(ucbp) = reinterpret_cast<_uw>(&__aeabi_unwind_cpp_pr2);
+          break;
+        default:
+          UCB_PR_ADDR(ucbp) = 0;
+          return _URC_FAILURE;
+      }
+    } else {
+      /* Execute region offset to PR.  */
+      UCB_PR_ADDR(ucbp) = selfrel_offset31(ucbp->pr_cache.ehtp);
+    }
+    return _URC_OK;
+  }
+
+  // Switched by start() to compare one walk against the two of EHABI. Only
+  // for throws that are always caught: the cleanups have run by the time a
+  // missing handler is noticed, so it terminates instead of returning to
+  // __cxa_throw.
+  std::atomic<bool> single_phase_unwind_enabled = false;
+
+  _Unwind_Reason_Code __real___gnu_Unwind_RaiseException( // NOLINT
+    _Unwind_Control_Block* ucbp,
+    phase2_vrs* entry_vrs);
+
+  /* Called by the _Unwind_RaiseException wrapper of libunwind.S with the
+     registers of the throw. Phase 1 walks to the handler on a copy of them,
+     phase 2 walks the same frames again to run the cleanups. With
+     single_phase_unwind_enabled each frame is looked up and unwound once.
+     Its personality routine runs the cleanups as phase 2 would, and installs
+     the handler in the first frame that has one. After a cleanup,
+     _Unwind_Resume carries on with libgcc's phase 2, which is one walk
+     already.  */
+  _Unwind_Reason_Code __wrap___gnu_Unwind_RaiseException( // NOLINT
+    _Unwind_Control_Block* ucbp,
+    phase2_vrs* entry_vrs)
+  {
+    if (!single_phase_unwind_enabled) {
+      return __real___gnu_Unwind_RaiseException(ucbp, entry_vrs);
+    }
+
+    /* Set the pc to the call site.  */
+    entry_vrs->core.r[R_PC] = entry_vrs->core.r[R_LR];
+    UCB_FORCED_STOP_FN(ucbp) = 0;
+    /* No stack pointer matches, so no frame is taken for the one phase 1
+       would have found and the personality routine searches each LSDA.  */
+    ucbp->barrier_cache.sp = 0;
+
+    auto* context = reinterpret_cast<_Unwind_Context*>(entry_vrs);
+    while (find_eit_entry(ucbp, entry_vrs->core.r[R_PC]) == _URC_OK) {
+      UCB_SAVED_CALLSITE_ADDR(ucbp) = entry_vrs->core.r[R_PC];
+      auto* personality =
+        reinterpret_cast<personality_routine>(UCB_PR_ADDR(ucbp));
+      auto result = personality(_US_UNWIND_FRAME_STARTING, ucbp, context);
+      if (result == _URC_INSTALL_CONTEXT) {
+        __restore_core_regs(&entry_vrs->core);
+      }
+      if (result != _URC_CONTINUE_UNWIND) {
+        break;
+      }
+    }
+    std::terminate();
+  }
 #endif
 } // extern "C"
 
@@ -670,8 +793,7 @@ int
 main()
 {
   dwt_counter_enable();
-  // Set flash accelerator to 1 CPU cycle per instruction
-  *reinterpret_cast<std::uint32_t*>(0x400F'C000) = 0xA;
+  enable_flash_accelerator();
   volatile int return_code = 0;
   try {
     return_code = start();
@@ -685,6 +807,36 @@ main()
 std::array<std::uint64_t, 25> cycle_map{};
 std::array<std::uint64_t, 25> happy_cycle_map{};
 
+// Each group thrown back to back, like a driver error out of a retry loop.
+// Measures the warm search_EIT_table cache next to the single throw above.
+constexpr std::size_t repeat_count = 16;
+std::array<std::uint64_t, 25> repeated_cycle_map{};
+std::array<std::uint64_t, 25> cache_hits{};
+std::array<std::uint64_t, 25> cache_misses{};
+std::array<std::uint32_t, repeat_count> repeat_cycles{};
+
+// Each group thrown once more with the .unwind_records fast path, compare
+// against cycle_map. Frames that still went through the bytecode are counted
+// per group.
+std::array<std::uint64_t, 25> record_cycle_map{};
+std::array<std::uint64_t, 25> record_frames{};
+std::array<std::uint64_t, 25> bytecode_frames{};
+
+// The repeated throws again with catch_match_lookup_cache in front of the
+// type match of gxx_personality.hpp, compare against repeated_cycle_map.
+std::array<std::uint64_t, 25> catch_cached_cycle_map{};
+std::array<std::uint64_t, 25> catch_cache_hits{};
+
+// Each group thrown once more with one walk over the frames instead of
+// EHABI's two, compare against cycle_map.
+std::array<std::uint64_t, 25> single_phase_cycle_map{};
+
+// Each group thrown once more with frames in .trivial_handle looked up in
+// their slice of .ARM.exidx, compare against cycle_map. trivial_lookups
+// counts the frames that took the slice.
+std::array<std::uint64_t, 25> trivial_cycle_map{};
+std::array<std::uint64_t, 25> trivial_lookup_map{};
+
 int
 funct_group0_0();
 int
@@ -782,12 +934,119 @@ start()
     }
   }
 
+  measure_call_latency();
+  index = 0;
+  for (auto& funct : functions) {
+    eit_lookup_cache.clear();
+    for (auto& cycles : repeat_cycles) {
+      try {
+        start_cycles = uptime();
+        funct();
+      } catch ([[maybe_unused]] const my_error_t& p_error) {
+        end_cycles = uptime();
+        cycles = elapsed_cycles(start_cycles, end_cycles);
+      }
+    }
+    repeated_cycle_map[index] = summarize(repeat_cycles).median;
+    cache_hits[index] = eit_lookup_cache.hits;
+    cache_misses[index] = eit_lookup_cache.misses;
+    index++;
+  }
+
+  unwind_records_enabled = true;
+  index = 0;
+  for (auto& funct : functions) {
+    eit_lookup_cache.clear();
+    unwind_record_frames = 0;
+    unwind_bytecode_frames = 0;
+    try {
+      start_cycles = uptime();
+      funct();
+    } catch ([[maybe_unused]] const my_error_t& p_error) {
+      end_cycles = uptime();
+      record_cycle_map[index] = end_cycles - start_cycles;
+    }
+    record_frames[index] = unwind_record_frames;
+    bytecode_frames[index] = unwind_bytecode_frames;
+    index++;
+  }
+  unwind_records_enabled = false;
+
+  catch_match_cache_enabled = true;
+  index = 0;
+  for (auto& funct : functions) {
+    eit_lookup_cache.clear();
+    catch_match_lookup_cache.clear();
+    for (auto& cycles : repeat_cycles) {
+      try {
+        start_cycles = uptime();
+        funct();
+      } catch ([[maybe_unused]] const my_error_t& p_error) {
+        end_cycles = uptime();
+        cycles = elapsed_cycles(start_cycles, end_cycles);
+      }
+    }
+    catch_cached_cycle_map[index] = summarize(repeat_cycles).median;
+    catch_cache_hits[index] = catch_match_lookup_cache.hits;
+    index++;
+  }
+  catch_match_cache_enabled = false;
+
+  single_phase_unwind_enabled = true;
+  index = 0;
+  for (auto& funct : functions) {
+    eit_lookup_cache.clear();
+    try {
+      start_cycles = uptime();
+      funct();
+    } catch ([[maybe_unused]] const my_error_t& p_error) {
+      end_cycles = uptime();
+      single_phase_cycle_map[index] = end_cycles - start_cycles;
+    }
+    index++;
+  }
+  single_phase_unwind_enabled = false;
+
+  trivial_lookup_enabled = true;
+  index = 0;
+  for (auto& funct : functions) {
+    eit_lookup_cache.clear();
+    trivial_lookups = 0;
+    try {
+      start_cycles = uptime();
+      funct();
+    } catch ([[maybe_unused]] const my_error_t& p_error) {
+      end_cycles = uptime();
+      trivial_cycle_map[index] = end_cycles - start_cycles;
+    }
+    trivial_lookup_map[index] = trivial_lookups;
+    index++;
+  }
+  trivial_lookup_enabled = false;
+
   start_cycles = uptime();
   void* ptr = __wrap___cxa_allocate_exception(32);
   __wrap___cxa_free_exception(ptr);
   end_cycles = uptime();
   allocation_cycles = end_cycles - start_cycles;
 
+  export_csv("group_index,cycles,happy_cycles,repeated_cycles,cache_hits,"
+             "cache_misses,record_cycles,record_frames,bytecode_frames,"
+             "catch_cached_cycles,catch_cache_hits,single_phase_cycles,"
+             "trivial_cycles,trivial_lookups",
+             cycle_map,
+             happy_cycle_map,
+             repeated_cycle_map,
+             cache_hits,
+             cache_misses,
+             record_cycle_map,
+             record_frames,
+             bytecode_frames,
+             catch_cached_cycle_map,
+             catch_cache_hits,
+             single_phase_cycle_map,
+             trivial_cycle_map,
+             trivial_lookup_map);
   return side_effect;
 }
 
@@ -853,7 +1112,7 @@ private:
 int
 funct_group0_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -867,7 +1126,7 @@ funct_group0_0()
 int
 funct_group0_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -881,7 +1140,7 @@ funct_group0_1()
 int
 funct_group0_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -895,7 +1154,7 @@ funct_group0_2()
 int
 funct_group0_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -909,7 +1168,7 @@ funct_group0_3()
 int
 funct_group0_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -922,7 +1181,7 @@ funct_group0_4()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group0_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -941,7 +1200,7 @@ funct_group0_5()
 int
 funct_group1_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -955,7 +1214,7 @@ funct_group1_0()
 int
 funct_group1_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -969,7 +1228,7 @@ funct_group1_1()
 int
 funct_group1_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -983,7 +1242,7 @@ funct_group1_2()
 int
 funct_group1_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -997,7 +1256,7 @@ funct_group1_3()
 int
 funct_group1_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1011,7 +1270,7 @@ funct_group1_4()
 int
 funct_group1_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1025,7 +1284,7 @@ funct_group1_5()
 int
 funct_group1_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1039,7 +1298,7 @@ funct_group1_6()
 int
 funct_group1_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1053,7 +1312,7 @@ funct_group1_7()
 int
 funct_group1_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1067,7 +1326,7 @@ funct_group1_8()
 int
 funct_group1_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1081,7 +1340,7 @@ funct_group1_9()
 int
 funct_group1_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1092,7 +1351,7 @@ funct_group1_10()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group1_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1111,7 +1370,7 @@ funct_group1_11()
 int
 funct_group2_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1125,7 +1384,7 @@ funct_group2_0()
 int
 funct_group2_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1139,7 +1398,7 @@ funct_group2_1()
 int
 funct_group2_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1153,7 +1412,7 @@ funct_group2_2()
 int
 funct_group2_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1167,7 +1426,7 @@ funct_group2_3()
 int
 funct_group2_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1181,7 +1440,7 @@ funct_group2_4()
 int
 funct_group2_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1195,7 +1454,7 @@ funct_group2_5()
 int
 funct_group2_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1209,7 +1468,7 @@ funct_group2_6()
 int
 funct_group2_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1223,7 +1482,7 @@ funct_group2_7()
 int
 funct_group2_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1237,7 +1496,7 @@ funct_group2_8()
 int
 funct_group2_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1251,7 +1510,7 @@ funct_group2_9()
 int
 funct_group2_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1265,7 +1524,7 @@ funct_group2_10()
 int
 funct_group2_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1279,7 +1538,7 @@ funct_group2_11()
 int
 funct_group2_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1293,7 +1552,7 @@ funct_group2_12()
 int
 funct_group2_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1307,7 +1566,7 @@ funct_group2_13()
 int
 funct_group2_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1321,7 +1580,7 @@ funct_group2_14()
 int
 funct_group2_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1335,7 +1594,7 @@ funct_group2_15()
 int
 funct_group2_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1349,7 +1608,7 @@ funct_group2_16()
 int
 funct_group2_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1363,7 +1622,7 @@ funct_group2_17()
 int
 funct_group2_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1377,7 +1636,7 @@ funct_group2_18()
 int
 funct_group2_20();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_19()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1391,7 +1650,7 @@ funct_group2_19()
 int
 funct_group2_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1405,7 +1664,7 @@ funct_group2_20()
 int
 funct_group2_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1419,7 +1678,7 @@ funct_group2_21()
 int
 funct_group2_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1430,7 +1689,7 @@ funct_group2_22()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group2_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1449,7 +1708,7 @@ funct_group2_23()
 int
 funct_group3_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1463,7 +1722,7 @@ funct_group3_0()
 int
 funct_group3_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1477,7 +1736,7 @@ funct_group3_1()
 int
 funct_group3_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1491,7 +1750,7 @@ funct_group3_2()
 int
 funct_group3_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1505,7 +1764,7 @@ funct_group3_3()
 int
 funct_group3_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1519,7 +1778,7 @@ funct_group3_4()
 int
 funct_group3_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1533,7 +1792,7 @@ funct_group3_5()
 int
 funct_group3_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1547,7 +1806,7 @@ funct_group3_6()
 int
 funct_group3_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1561,7 +1820,7 @@ funct_group3_7()
 int
 funct_group3_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1575,7 +1834,7 @@ funct_group3_8()
 int
 funct_group3_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1589,7 +1848,7 @@ funct_group3_9()
 int
 funct_group3_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1603,7 +1862,7 @@ funct_group3_10()
 int
 funct_group3_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1617,7 +1876,7 @@ funct_group3_11()
 int
 funct_group3_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1631,7 +1890,7 @@ funct_group3_12()
 int
 funct_group3_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1645,7 +1904,7 @@ funct_group3_13()
 int
 funct_group3_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1659,7 +1918,7 @@ funct_group3_14()
 int
 funct_group3_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1673,7 +1932,7 @@ funct_group3_15()
 int
 funct_group3_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1687,7 +1946,7 @@ funct_group3_16()
 int
 funct_group3_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1701,7 +1960,7 @@ funct_group3_17()
 int
 funct_group3_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1715,7 +1974,7 @@ funct_group3_18()
 int
 funct_group3_20();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_19()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1729,7 +1988,7 @@ funct_group3_19()
 int
 funct_group3_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1743,7 +2002,7 @@ funct_group3_20()
 int
 funct_group3_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1757,7 +2016,7 @@ funct_group3_21()
 int
 funct_group3_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1771,7 +2030,7 @@ funct_group3_22()
 int
 funct_group3_24();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1785,7 +2044,7 @@ funct_group3_23()
 int
 funct_group3_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1799,7 +2058,7 @@ funct_group3_24()
 int
 funct_group3_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1813,7 +2072,7 @@ funct_group3_25()
 int
 funct_group3_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1827,7 +2086,7 @@ funct_group3_26()
 int
 funct_group3_28();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_27()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1841,7 +2100,7 @@ funct_group3_27()
 int
 funct_group3_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1855,7 +2114,7 @@ funct_group3_28()
 int
 funct_group3_30();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_29()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1869,7 +2128,7 @@ funct_group3_29()
 int
 funct_group3_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1883,7 +2142,7 @@ funct_group3_30()
 int
 funct_group3_32();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_31()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1897,7 +2156,7 @@ funct_group3_31()
 int
 funct_group3_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1911,7 +2170,7 @@ funct_group3_32()
 int
 funct_group3_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1925,7 +2184,7 @@ funct_group3_33()
 int
 funct_group3_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1939,7 +2198,7 @@ funct_group3_34()
 int
 funct_group3_36();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_35()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1953,7 +2212,7 @@ funct_group3_35()
 int
 funct_group3_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1967,7 +2226,7 @@ funct_group3_36()
 int
 funct_group3_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1981,7 +2240,7 @@ funct_group3_37()
 int
 funct_group3_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -1995,7 +2254,7 @@ funct_group3_38()
 int
 funct_group3_40();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_39()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2009,7 +2268,7 @@ funct_group3_39()
 int
 funct_group3_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2023,7 +2282,7 @@ funct_group3_40()
 int
 funct_group3_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2037,7 +2296,7 @@ funct_group3_41()
 int
 funct_group3_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2051,7 +2310,7 @@ funct_group3_42()
 int
 funct_group3_44();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_43()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2065,7 +2324,7 @@ funct_group3_43()
 int
 funct_group3_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2079,7 +2338,7 @@ funct_group3_44()
 int
 funct_group3_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2093,7 +2352,7 @@ funct_group3_45()
 int
 funct_group3_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2104,7 +2363,7 @@ funct_group3_46()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group3_47()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2123,7 +2382,7 @@ funct_group3_47()
 int
 funct_group4_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2137,7 +2396,7 @@ funct_group4_0()
 int
 funct_group4_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2151,7 +2410,7 @@ funct_group4_1()
 int
 funct_group4_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2165,7 +2424,7 @@ funct_group4_2()
 int
 funct_group4_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2179,7 +2438,7 @@ funct_group4_3()
 int
 funct_group4_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2193,7 +2452,7 @@ funct_group4_4()
 int
 funct_group4_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2207,7 +2466,7 @@ funct_group4_5()
 int
 funct_group4_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2221,7 +2480,7 @@ funct_group4_6()
 int
 funct_group4_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2235,7 +2494,7 @@ funct_group4_7()
 int
 funct_group4_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2249,7 +2508,7 @@ funct_group4_8()
 int
 funct_group4_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2263,7 +2522,7 @@ funct_group4_9()
 int
 funct_group4_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2277,7 +2536,7 @@ funct_group4_10()
 int
 funct_group4_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2291,7 +2550,7 @@ funct_group4_11()
 int
 funct_group4_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2305,7 +2564,7 @@ funct_group4_12()
 int
 funct_group4_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2319,7 +2578,7 @@ funct_group4_13()
 int
 funct_group4_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2333,7 +2592,7 @@ funct_group4_14()
 int
 funct_group4_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2347,7 +2606,7 @@ funct_group4_15()
 int
 funct_group4_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2361,7 +2620,7 @@ funct_group4_16()
 int
 funct_group4_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2375,7 +2634,7 @@ funct_group4_17()
 int
 funct_group4_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2389,7 +2648,7 @@ funct_group4_18()
 int
 funct_group4_20();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_19()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2403,7 +2662,7 @@ funct_group4_19()
 int
 funct_group4_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2417,7 +2676,7 @@ funct_group4_20()
 int
 funct_group4_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2431,7 +2690,7 @@ funct_group4_21()
 int
 funct_group4_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2445,7 +2704,7 @@ funct_group4_22()
 int
 funct_group4_24();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2459,7 +2718,7 @@ funct_group4_23()
 int
 funct_group4_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2473,7 +2732,7 @@ funct_group4_24()
 int
 funct_group4_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2487,7 +2746,7 @@ funct_group4_25()
 int
 funct_group4_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2501,7 +2760,7 @@ funct_group4_26()
 int
 funct_group4_28();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_27()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2515,7 +2774,7 @@ funct_group4_27()
 int
 funct_group4_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2529,7 +2788,7 @@ funct_group4_28()
 int
 funct_group4_30();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_29()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2543,7 +2802,7 @@ funct_group4_29()
 int
 funct_group4_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2557,7 +2816,7 @@ funct_group4_30()
 int
 funct_group4_32();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_31()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2571,7 +2830,7 @@ funct_group4_31()
 int
 funct_group4_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2585,7 +2844,7 @@ funct_group4_32()
 int
 funct_group4_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2599,7 +2858,7 @@ funct_group4_33()
 int
 funct_group4_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2613,7 +2872,7 @@ funct_group4_34()
 int
 funct_group4_36();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_35()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2627,7 +2886,7 @@ funct_group4_35()
 int
 funct_group4_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2641,7 +2900,7 @@ funct_group4_36()
 int
 funct_group4_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2655,7 +2914,7 @@ funct_group4_37()
 int
 funct_group4_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2669,7 +2928,7 @@ funct_group4_38()
 int
 funct_group4_40();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_39()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2683,7 +2942,7 @@ funct_group4_39()
 int
 funct_group4_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2697,7 +2956,7 @@ funct_group4_40()
 int
 funct_group4_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2711,7 +2970,7 @@ funct_group4_41()
 int
 funct_group4_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2725,7 +2984,7 @@ funct_group4_42()
 int
 funct_group4_44();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_43()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2739,7 +2998,7 @@ funct_group4_43()
 int
 funct_group4_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2753,7 +3012,7 @@ funct_group4_44()
 int
 funct_group4_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2767,7 +3026,7 @@ funct_group4_45()
 int
 funct_group4_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2781,7 +3040,7 @@ funct_group4_46()
 int
 funct_group4_48();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_47()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2795,7 +3054,7 @@ funct_group4_47()
 int
 funct_group4_49();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_48()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2809,7 +3068,7 @@ funct_group4_48()
 int
 funct_group4_50();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_49()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2823,7 +3082,7 @@ funct_group4_49()
 int
 funct_group4_51();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_50()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2837,7 +3096,7 @@ funct_group4_50()
 int
 funct_group4_52();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_51()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2851,7 +3110,7 @@ funct_group4_51()
 int
 funct_group4_53();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_52()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2865,7 +3124,7 @@ funct_group4_52()
 int
 funct_group4_54();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_53()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2879,7 +3138,7 @@ funct_group4_53()
 int
 funct_group4_55();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_54()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2893,7 +3152,7 @@ funct_group4_54()
 int
 funct_group4_56();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_55()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2907,7 +3166,7 @@ funct_group4_55()
 int
 funct_group4_57();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_56()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2921,7 +3180,7 @@ funct_group4_56()
 int
 funct_group4_58();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_57()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2935,7 +3194,7 @@ funct_group4_57()
 int
 funct_group4_59();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_58()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2949,7 +3208,7 @@ funct_group4_58()
 int
 funct_group4_60();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_59()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2963,7 +3222,7 @@ funct_group4_59()
 int
 funct_group4_61();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_60()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2977,7 +3236,7 @@ funct_group4_60()
 int
 funct_group4_62();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_61()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -2991,7 +3250,7 @@ funct_group4_61()
 int
 funct_group4_63();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_62()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3005,7 +3264,7 @@ funct_group4_62()
 int
 funct_group4_64();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_63()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3019,7 +3278,7 @@ funct_group4_63()
 int
 funct_group4_65();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_64()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3033,7 +3292,7 @@ funct_group4_64()
 int
 funct_group4_66();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_65()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3047,7 +3306,7 @@ funct_group4_65()
 int
 funct_group4_67();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_66()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3061,7 +3320,7 @@ funct_group4_66()
 int
 funct_group4_68();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_67()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3075,7 +3334,7 @@ funct_group4_67()
 int
 funct_group4_69();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_68()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3089,7 +3348,7 @@ funct_group4_68()
 int
 funct_group4_70();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_69()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3103,7 +3362,7 @@ funct_group4_69()
 int
 funct_group4_71();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_70()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3117,7 +3376,7 @@ funct_group4_70()
 int
 funct_group4_72();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_71()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3131,7 +3390,7 @@ funct_group4_71()
 int
 funct_group4_73();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_72()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3145,7 +3404,7 @@ funct_group4_72()
 int
 funct_group4_74();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_73()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3159,7 +3418,7 @@ funct_group4_73()
 int
 funct_group4_75();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_74()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3173,7 +3432,7 @@ funct_group4_74()
 int
 funct_group4_76();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_75()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3187,7 +3446,7 @@ funct_group4_75()
 int
 funct_group4_77();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_76()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3201,7 +3460,7 @@ funct_group4_76()
 int
 funct_group4_78();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_77()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3215,7 +3474,7 @@ funct_group4_77()
 int
 funct_group4_79();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_78()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3229,7 +3488,7 @@ funct_group4_78()
 int
 funct_group4_80();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_79()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3243,7 +3502,7 @@ funct_group4_79()
 int
 funct_group4_81();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_80()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3257,7 +3516,7 @@ funct_group4_80()
 int
 funct_group4_82();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_81()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3271,7 +3530,7 @@ funct_group4_81()
 int
 funct_group4_83();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_82()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3285,7 +3544,7 @@ funct_group4_82()
 int
 funct_group4_84();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_83()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3299,7 +3558,7 @@ funct_group4_83()
 int
 funct_group4_85();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_84()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3313,7 +3572,7 @@ funct_group4_84()
 int
 funct_group4_86();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_85()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3327,7 +3586,7 @@ funct_group4_85()
 int
 funct_group4_87();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_86()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3341,7 +3600,7 @@ funct_group4_86()
 int
 funct_group4_88();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_87()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3355,7 +3614,7 @@ funct_group4_87()
 int
 funct_group4_89();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_88()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3369,7 +3628,7 @@ funct_group4_88()
 int
 funct_group4_90();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_89()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3383,7 +3642,7 @@ funct_group4_89()
 int
 funct_group4_91();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_90()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3397,7 +3656,7 @@ funct_group4_90()
 int
 funct_group4_92();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_91()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3411,7 +3670,7 @@ funct_group4_91()
 int
 funct_group4_93();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_92()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3425,7 +3684,7 @@ funct_group4_92()
 int
 funct_group4_94();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_93()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3439,7 +3698,7 @@ funct_group4_93()
 int
 funct_group4_95();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_94()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3450,7 +3709,7 @@ funct_group4_94()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group4_95()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3469,7 +3728,7 @@ funct_group4_95()
 int
 funct_group5_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3483,7 +3742,7 @@ funct_group5_0()
 int
 funct_group5_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3497,7 +3756,7 @@ funct_group5_1()
 int
 funct_group5_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3511,7 +3770,7 @@ funct_group5_2()
 int
 funct_group5_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3525,7 +3784,7 @@ funct_group5_3()
 int
 funct_group5_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3536,7 +3795,7 @@ funct_group5_4()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group5_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3555,7 +3814,7 @@ funct_group5_5()
 int
 funct_group6_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3569,7 +3828,7 @@ funct_group6_0()
 int
 funct_group6_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3583,7 +3842,7 @@ funct_group6_1()
 int
 funct_group6_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3597,7 +3856,7 @@ funct_group6_2()
 int
 funct_group6_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3611,7 +3870,7 @@ funct_group6_3()
 int
 funct_group6_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3625,7 +3884,7 @@ funct_group6_4()
 int
 funct_group6_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3639,7 +3898,7 @@ funct_group6_5()
 int
 funct_group6_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3653,7 +3912,7 @@ funct_group6_6()
 int
 funct_group6_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3667,7 +3926,7 @@ funct_group6_7()
 int
 funct_group6_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3695,7 +3954,7 @@ funct_group6_9()
 int
 funct_group6_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3706,7 +3965,7 @@ funct_group6_10()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group6_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3725,7 +3984,7 @@ funct_group6_11()
 int
 funct_group7_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3739,7 +3998,7 @@ funct_group7_0()
 int
 funct_group7_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3753,7 +4012,7 @@ funct_group7_1()
 int
 funct_group7_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3767,7 +4026,7 @@ funct_group7_2()
 int
 funct_group7_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3781,7 +4040,7 @@ funct_group7_3()
 int
 funct_group7_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3795,7 +4054,7 @@ funct_group7_4()
 int
 funct_group7_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3809,7 +4068,7 @@ funct_group7_5()
 int
 funct_group7_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3823,7 +4082,7 @@ funct_group7_6()
 int
 funct_group7_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3837,7 +4096,7 @@ funct_group7_7()
 int
 funct_group7_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3865,7 +4124,7 @@ funct_group7_9()
 int
 funct_group7_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3879,7 +4138,7 @@ funct_group7_10()
 int
 funct_group7_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3893,7 +4152,7 @@ funct_group7_11()
 int
 funct_group7_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3907,7 +4166,7 @@ funct_group7_12()
 int
 funct_group7_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3921,7 +4180,7 @@ funct_group7_13()
 int
 funct_group7_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3935,7 +4194,7 @@ funct_group7_14()
 int
 funct_group7_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3949,7 +4208,7 @@ funct_group7_15()
 int
 funct_group7_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3963,7 +4222,7 @@ funct_group7_16()
 int
 funct_group7_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -3977,7 +4236,7 @@ funct_group7_17()
 int
 funct_group7_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4005,7 +4264,7 @@ funct_group7_19()
 int
 funct_group7_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4019,7 +4278,7 @@ funct_group7_20()
 int
 funct_group7_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4033,7 +4292,7 @@ funct_group7_21()
 int
 funct_group7_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4044,7 +4303,7 @@ funct_group7_22()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group7_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4063,7 +4322,7 @@ funct_group7_23()
 int
 funct_group8_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4077,7 +4336,7 @@ funct_group8_0()
 int
 funct_group8_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4091,7 +4350,7 @@ funct_group8_1()
 int
 funct_group8_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4105,7 +4364,7 @@ funct_group8_2()
 int
 funct_group8_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4119,7 +4378,7 @@ funct_group8_3()
 int
 funct_group8_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4133,7 +4392,7 @@ funct_group8_4()
 int
 funct_group8_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4147,7 +4406,7 @@ funct_group8_5()
 int
 funct_group8_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4161,7 +4420,7 @@ funct_group8_6()
 int
 funct_group8_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4175,7 +4434,7 @@ funct_group8_7()
 int
 funct_group8_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4203,7 +4462,7 @@ funct_group8_9()
 int
 funct_group8_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4217,7 +4476,7 @@ funct_group8_10()
 int
 funct_group8_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4231,7 +4490,7 @@ funct_group8_11()
 int
 funct_group8_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4245,7 +4504,7 @@ funct_group8_12()
 int
 funct_group8_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4259,7 +4518,7 @@ funct_group8_13()
 int
 funct_group8_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4273,7 +4532,7 @@ funct_group8_14()
 int
 funct_group8_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4287,7 +4546,7 @@ funct_group8_15()
 int
 funct_group8_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4301,7 +4560,7 @@ funct_group8_16()
 int
 funct_group8_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4315,7 +4574,7 @@ funct_group8_17()
 int
 funct_group8_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4343,7 +4602,7 @@ funct_group8_19()
 int
 funct_group8_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4357,7 +4616,7 @@ funct_group8_20()
 int
 funct_group8_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4371,7 +4630,7 @@ funct_group8_21()
 int
 funct_group8_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4385,7 +4644,7 @@ funct_group8_22()
 int
 funct_group8_24();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4399,7 +4658,7 @@ funct_group8_23()
 int
 funct_group8_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4413,7 +4672,7 @@ funct_group8_24()
 int
 funct_group8_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4427,7 +4686,7 @@ funct_group8_25()
 int
 funct_group8_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4441,7 +4700,7 @@ funct_group8_26()
 int
 funct_group8_28();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_27()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4455,7 +4714,7 @@ funct_group8_27()
 int
 funct_group8_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4483,7 +4742,7 @@ funct_group8_29()
 int
 funct_group8_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4497,7 +4756,7 @@ funct_group8_30()
 int
 funct_group8_32();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_31()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4511,7 +4770,7 @@ funct_group8_31()
 int
 funct_group8_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4525,7 +4784,7 @@ funct_group8_32()
 int
 funct_group8_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4539,7 +4798,7 @@ funct_group8_33()
 int
 funct_group8_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4553,7 +4812,7 @@ funct_group8_34()
 int
 funct_group8_36();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_35()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4567,7 +4826,7 @@ funct_group8_35()
 int
 funct_group8_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4581,7 +4840,7 @@ funct_group8_36()
 int
 funct_group8_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4595,7 +4854,7 @@ funct_group8_37()
 int
 funct_group8_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4623,7 +4882,7 @@ funct_group8_39()
 int
 funct_group8_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4637,7 +4896,7 @@ funct_group8_40()
 int
 funct_group8_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4651,7 +4910,7 @@ funct_group8_41()
 int
 funct_group8_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4665,7 +4924,7 @@ funct_group8_42()
 int
 funct_group8_44();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_43()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4679,7 +4938,7 @@ funct_group8_43()
 int
 funct_group8_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4693,7 +4952,7 @@ funct_group8_44()
 int
 funct_group8_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4707,7 +4966,7 @@ funct_group8_45()
 int
 funct_group8_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4718,7 +4977,7 @@ funct_group8_46()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group8_47()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4737,7 +4996,7 @@ funct_group8_47()
 int
 funct_group9_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4751,7 +5010,7 @@ funct_group9_0()
 int
 funct_group9_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4765,7 +5024,7 @@ funct_group9_1()
 int
 funct_group9_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4779,7 +5038,7 @@ funct_group9_2()
 int
 funct_group9_4();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_3()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4793,7 +5052,7 @@ funct_group9_3()
 int
 funct_group9_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4807,7 +5066,7 @@ funct_group9_4()
 int
 funct_group9_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4821,7 +5080,7 @@ funct_group9_5()
 int
 funct_group9_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4835,7 +5094,7 @@ funct_group9_6()
 int
 funct_group9_8();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_7()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4849,7 +5108,7 @@ funct_group9_7()
 int
 funct_group9_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4877,7 +5136,7 @@ funct_group9_9()
 int
 funct_group9_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4891,7 +5150,7 @@ funct_group9_10()
 int
 funct_group9_12();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_11()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4905,7 +5164,7 @@ funct_group9_11()
 int
 funct_group9_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4919,7 +5178,7 @@ funct_group9_12()
 int
 funct_group9_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4933,7 +5192,7 @@ funct_group9_13()
 int
 funct_group9_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4947,7 +5206,7 @@ funct_group9_14()
 int
 funct_group9_16();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_15()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4961,7 +5220,7 @@ funct_group9_15()
 int
 funct_group9_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4975,7 +5234,7 @@ funct_group9_16()
 int
 funct_group9_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -4989,7 +5248,7 @@ funct_group9_17()
 int
 funct_group9_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5017,7 +5276,7 @@ funct_group9_19()
 int
 funct_group9_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5031,7 +5290,7 @@ funct_group9_20()
 int
 funct_group9_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5045,7 +5304,7 @@ funct_group9_21()
 int
 funct_group9_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5059,7 +5318,7 @@ funct_group9_22()
 int
 funct_group9_24();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_23()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5073,7 +5332,7 @@ funct_group9_23()
 int
 funct_group9_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5087,7 +5346,7 @@ funct_group9_24()
 int
 funct_group9_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5101,7 +5360,7 @@ funct_group9_25()
 int
 funct_group9_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5115,7 +5374,7 @@ funct_group9_26()
 int
 funct_group9_28();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_27()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5129,7 +5388,7 @@ funct_group9_27()
 int
 funct_group9_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5157,7 +5416,7 @@ funct_group9_29()
 int
 funct_group9_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5171,7 +5430,7 @@ funct_group9_30()
 int
 funct_group9_32();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_31()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5185,7 +5444,7 @@ funct_group9_31()
 int
 funct_group9_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5199,7 +5458,7 @@ funct_group9_32()
 int
 funct_group9_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5213,7 +5472,7 @@ funct_group9_33()
 int
 funct_group9_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5227,7 +5486,7 @@ funct_group9_34()
 int
 funct_group9_36();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_35()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5241,7 +5500,7 @@ funct_group9_35()
 int
 funct_group9_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5255,7 +5514,7 @@ funct_group9_36()
 int
 funct_group9_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5269,7 +5528,7 @@ funct_group9_37()
 int
 funct_group9_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5297,7 +5556,7 @@ funct_group9_39()
 int
 funct_group9_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5311,7 +5570,7 @@ funct_group9_40()
 int
 funct_group9_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5325,7 +5584,7 @@ funct_group9_41()
 int
 funct_group9_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5339,7 +5598,7 @@ funct_group9_42()
 int
 funct_group9_44();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_43()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5353,7 +5612,7 @@ funct_group9_43()
 int
 funct_group9_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5367,7 +5626,7 @@ funct_group9_44()
 int
 funct_group9_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5381,7 +5640,7 @@ funct_group9_45()
 int
 funct_group9_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5395,7 +5654,7 @@ funct_group9_46()
 int
 funct_group9_48();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_47()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5409,7 +5668,7 @@ funct_group9_47()
 int
 funct_group9_49();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_48()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5437,7 +5696,7 @@ funct_group9_49()
 int
 funct_group9_51();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_50()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5451,7 +5710,7 @@ funct_group9_50()
 int
 funct_group9_52();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_51()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5465,7 +5724,7 @@ funct_group9_51()
 int
 funct_group9_53();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_52()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5479,7 +5738,7 @@ funct_group9_52()
 int
 funct_group9_54();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_53()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5493,7 +5752,7 @@ funct_group9_53()
 int
 funct_group9_55();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_54()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5507,7 +5766,7 @@ funct_group9_54()
 int
 funct_group9_56();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_55()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5521,7 +5780,7 @@ funct_group9_55()
 int
 funct_group9_57();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_56()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5535,7 +5794,7 @@ funct_group9_56()
 int
 funct_group9_58();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_57()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5549,7 +5808,7 @@ funct_group9_57()
 int
 funct_group9_59();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_58()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5577,7 +5836,7 @@ funct_group9_59()
 int
 funct_group9_61();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_60()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5591,7 +5850,7 @@ funct_group9_60()
 int
 funct_group9_62();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_61()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5605,7 +5864,7 @@ funct_group9_61()
 int
 funct_group9_63();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_62()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5619,7 +5878,7 @@ funct_group9_62()
 int
 funct_group9_64();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_63()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5633,7 +5892,7 @@ funct_group9_63()
 int
 funct_group9_65();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_64()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5647,7 +5906,7 @@ funct_group9_64()
 int
 funct_group9_66();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_65()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5661,7 +5920,7 @@ funct_group9_65()
 int
 funct_group9_67();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_66()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5675,7 +5934,7 @@ funct_group9_66()
 int
 funct_group9_68();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_67()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5689,7 +5948,7 @@ funct_group9_67()
 int
 funct_group9_69();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_68()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5717,7 +5976,7 @@ funct_group9_69()
 int
 funct_group9_71();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_70()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5731,7 +5990,7 @@ funct_group9_70()
 int
 funct_group9_72();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_71()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5745,7 +6004,7 @@ funct_group9_71()
 int
 funct_group9_73();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_72()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5759,7 +6018,7 @@ funct_group9_72()
 int
 funct_group9_74();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_73()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5773,7 +6032,7 @@ funct_group9_73()
 int
 funct_group9_75();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_74()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5787,7 +6046,7 @@ funct_group9_74()
 int
 funct_group9_76();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_75()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5801,7 +6060,7 @@ funct_group9_75()
 int
 funct_group9_77();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_76()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5815,7 +6074,7 @@ funct_group9_76()
 int
 funct_group9_78();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_77()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5829,7 +6088,7 @@ funct_group9_77()
 int
 funct_group9_79();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_78()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5857,7 +6116,7 @@ funct_group9_79()
 int
 funct_group9_81();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_80()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5871,7 +6130,7 @@ funct_group9_80()
 int
 funct_group9_82();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_81()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5885,7 +6144,7 @@ funct_group9_81()
 int
 funct_group9_83();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_82()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5899,7 +6158,7 @@ funct_group9_82()
 int
 funct_group9_84();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_83()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5913,7 +6172,7 @@ funct_group9_83()
 int
 funct_group9_85();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_84()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5927,7 +6186,7 @@ funct_group9_84()
 int
 funct_group9_86();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_85()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5941,7 +6200,7 @@ funct_group9_85()
 int
 funct_group9_87();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_86()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5955,7 +6214,7 @@ funct_group9_86()
 int
 funct_group9_88();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_87()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5969,7 +6228,7 @@ funct_group9_87()
 int
 funct_group9_89();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_88()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -5997,7 +6256,7 @@ funct_group9_89()
 int
 funct_group9_91();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_90()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6011,7 +6270,7 @@ funct_group9_90()
 int
 funct_group9_92();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_91()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6025,7 +6284,7 @@ funct_group9_91()
 int
 funct_group9_93();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_92()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6039,7 +6298,7 @@ funct_group9_92()
 int
 funct_group9_94();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_93()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6053,7 +6312,7 @@ funct_group9_93()
 int
 funct_group9_95();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_94()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6064,7 +6323,7 @@ funct_group9_94()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group9_95()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6083,7 +6342,7 @@ funct_group9_95()
 int
 funct_group10_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group10_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6097,7 +6356,7 @@ funct_group10_0()
 int
 funct_group10_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group10_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6111,7 +6370,7 @@ funct_group10_1()
 int
 funct_group10_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group10_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6139,7 +6398,7 @@ funct_group10_3()
 int
 funct_group10_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group10_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6150,7 +6409,7 @@ funct_group10_4()
   return side_effect;
 }
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group10_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6169,7 +6428,7 @@ funct_group10_5()
 int
 funct_group11_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6183,7 +6442,7 @@ funct_group11_0()
 int
 funct_group11_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6197,7 +6456,7 @@ funct_group11_1()
 int
 funct_group11_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6225,7 +6484,7 @@ funct_group11_3()
 int
 funct_group11_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6239,7 +6498,7 @@ funct_group11_4()
 int
 funct_group11_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6253,7 +6512,7 @@ funct_group11_5()
 int
 funct_group11_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6281,7 +6540,7 @@ funct_group11_7()
 int
 funct_group11_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6295,7 +6554,7 @@ funct_group11_8()
 int
 funct_group11_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6309,7 +6568,7 @@ funct_group11_9()
 int
 funct_group11_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group11_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6339,7 +6598,7 @@ funct_group11_11()
 int
 funct_group12_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6353,7 +6612,7 @@ funct_group12_0()
 int
 funct_group12_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6367,7 +6626,7 @@ funct_group12_1()
 int
 funct_group12_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6395,7 +6654,7 @@ funct_group12_3()
 int
 funct_group12_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6409,7 +6668,7 @@ funct_group12_4()
 int
 funct_group12_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6423,7 +6682,7 @@ funct_group12_5()
 int
 funct_group12_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6451,7 +6710,7 @@ funct_group12_7()
 int
 funct_group12_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6465,7 +6724,7 @@ funct_group12_8()
 int
 funct_group12_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6479,7 +6738,7 @@ funct_group12_9()
 int
 funct_group12_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6507,7 +6766,7 @@ funct_group12_11()
 int
 funct_group12_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6521,7 +6780,7 @@ funct_group12_12()
 int
 funct_group12_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6535,7 +6794,7 @@ funct_group12_13()
 int
 funct_group12_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6563,7 +6822,7 @@ funct_group12_15()
 int
 funct_group12_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6577,7 +6836,7 @@ funct_group12_16()
 int
 funct_group12_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6591,7 +6850,7 @@ funct_group12_17()
 int
 funct_group12_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6619,7 +6878,7 @@ funct_group12_19()
 int
 funct_group12_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6633,7 +6892,7 @@ funct_group12_20()
 int
 funct_group12_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6647,7 +6906,7 @@ funct_group12_21()
 int
 funct_group12_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group12_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6677,7 +6936,7 @@ funct_group12_23()
 int
 funct_group13_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6691,7 +6950,7 @@ funct_group13_0()
 int
 funct_group13_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6705,7 +6964,7 @@ funct_group13_1()
 int
 funct_group13_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6733,7 +6992,7 @@ funct_group13_3()
 int
 funct_group13_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6747,7 +7006,7 @@ funct_group13_4()
 int
 funct_group13_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6761,7 +7020,7 @@ funct_group13_5()
 int
 funct_group13_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6789,7 +7048,7 @@ funct_group13_7()
 int
 funct_group13_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6803,7 +7062,7 @@ funct_group13_8()
 int
 funct_group13_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6817,7 +7076,7 @@ funct_group13_9()
 int
 funct_group13_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6845,7 +7104,7 @@ funct_group13_11()
 int
 funct_group13_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6859,7 +7118,7 @@ funct_group13_12()
 int
 funct_group13_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6873,7 +7132,7 @@ funct_group13_13()
 int
 funct_group13_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6901,7 +7160,7 @@ funct_group13_15()
 int
 funct_group13_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6915,7 +7174,7 @@ funct_group13_16()
 int
 funct_group13_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6929,7 +7188,7 @@ funct_group13_17()
 int
 funct_group13_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6957,7 +7216,7 @@ funct_group13_19()
 int
 funct_group13_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6971,7 +7230,7 @@ funct_group13_20()
 int
 funct_group13_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -6985,7 +7244,7 @@ funct_group13_21()
 int
 funct_group13_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7013,7 +7272,7 @@ funct_group13_23()
 int
 funct_group13_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7027,7 +7286,7 @@ funct_group13_24()
 int
 funct_group13_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7041,7 +7300,7 @@ funct_group13_25()
 int
 funct_group13_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7069,7 +7328,7 @@ funct_group13_27()
 int
 funct_group13_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7083,7 +7342,7 @@ funct_group13_28()
 int
 funct_group13_30();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_29()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7097,7 +7356,7 @@ funct_group13_29()
 int
 funct_group13_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7125,7 +7384,7 @@ funct_group13_31()
 int
 funct_group13_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7139,7 +7398,7 @@ funct_group13_32()
 int
 funct_group13_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7153,7 +7412,7 @@ funct_group13_33()
 int
 funct_group13_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7181,7 +7440,7 @@ funct_group13_35()
 int
 funct_group13_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7195,7 +7454,7 @@ funct_group13_36()
 int
 funct_group13_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7209,7 +7468,7 @@ funct_group13_37()
 int
 funct_group13_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7237,7 +7496,7 @@ funct_group13_39()
 int
 funct_group13_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7251,7 +7510,7 @@ funct_group13_40()
 int
 funct_group13_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7265,7 +7524,7 @@ funct_group13_41()
 int
 funct_group13_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7293,7 +7552,7 @@ funct_group13_43()
 int
 funct_group13_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7307,7 +7566,7 @@ funct_group13_44()
 int
 funct_group13_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7321,7 +7580,7 @@ funct_group13_45()
 int
 funct_group13_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group13_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7351,7 +7610,7 @@ funct_group13_47()
 int
 funct_group14_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7365,7 +7624,7 @@ funct_group14_0()
 int
 funct_group14_2();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_1()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7379,7 +7638,7 @@ funct_group14_1()
 int
 funct_group14_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7407,7 +7666,7 @@ funct_group14_3()
 int
 funct_group14_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7421,7 +7680,7 @@ funct_group14_4()
 int
 funct_group14_6();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_5()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7435,7 +7694,7 @@ funct_group14_5()
 int
 funct_group14_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7463,7 +7722,7 @@ funct_group14_7()
 int
 funct_group14_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7477,7 +7736,7 @@ funct_group14_8()
 int
 funct_group14_10();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_9()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7491,7 +7750,7 @@ funct_group14_9()
 int
 funct_group14_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7519,7 +7778,7 @@ funct_group14_11()
 int
 funct_group14_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7533,7 +7792,7 @@ funct_group14_12()
 int
 funct_group14_14();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_13()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7547,7 +7806,7 @@ funct_group14_13()
 int
 funct_group14_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7575,7 +7834,7 @@ funct_group14_15()
 int
 funct_group14_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7589,7 +7848,7 @@ funct_group14_16()
 int
 funct_group14_18();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_17()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7603,7 +7862,7 @@ funct_group14_17()
 int
 funct_group14_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7631,7 +7890,7 @@ funct_group14_19()
 int
 funct_group14_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7645,7 +7904,7 @@ funct_group14_20()
 int
 funct_group14_22();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_21()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7659,7 +7918,7 @@ funct_group14_21()
 int
 funct_group14_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7687,7 +7946,7 @@ funct_group14_23()
 int
 funct_group14_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7701,7 +7960,7 @@ funct_group14_24()
 int
 funct_group14_26();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_25()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7715,7 +7974,7 @@ funct_group14_25()
 int
 funct_group14_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7743,7 +8002,7 @@ funct_group14_27()
 int
 funct_group14_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7757,7 +8016,7 @@ funct_group14_28()
 int
 funct_group14_30();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_29()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7771,7 +8030,7 @@ funct_group14_29()
 int
 funct_group14_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7799,7 +8058,7 @@ funct_group14_31()
 int
 funct_group14_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7813,7 +8072,7 @@ funct_group14_32()
 int
 funct_group14_34();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_33()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7827,7 +8086,7 @@ funct_group14_33()
 int
 funct_group14_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7855,7 +8114,7 @@ funct_group14_35()
 int
 funct_group14_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7869,7 +8128,7 @@ funct_group14_36()
 int
 funct_group14_38();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_37()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7883,7 +8142,7 @@ funct_group14_37()
 int
 funct_group14_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7911,7 +8170,7 @@ funct_group14_39()
 int
 funct_group14_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7925,7 +8184,7 @@ funct_group14_40()
 int
 funct_group14_42();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_41()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7939,7 +8198,7 @@ funct_group14_41()
 int
 funct_group14_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7967,7 +8226,7 @@ funct_group14_43()
 int
 funct_group14_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7981,7 +8240,7 @@ funct_group14_44()
 int
 funct_group14_46();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_45()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -7995,7 +8254,7 @@ funct_group14_45()
 int
 funct_group14_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8023,7 +8282,7 @@ funct_group14_47()
 int
 funct_group14_49();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_48()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8037,7 +8296,7 @@ funct_group14_48()
 int
 funct_group14_50();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_49()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8051,7 +8310,7 @@ funct_group14_49()
 int
 funct_group14_51();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_50()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8079,7 +8338,7 @@ funct_group14_51()
 int
 funct_group14_53();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_52()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8093,7 +8352,7 @@ funct_group14_52()
 int
 funct_group14_54();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_53()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8107,7 +8366,7 @@ funct_group14_53()
 int
 funct_group14_55();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_54()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8135,7 +8394,7 @@ funct_group14_55()
 int
 funct_group14_57();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_56()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8149,7 +8408,7 @@ funct_group14_56()
 int
 funct_group14_58();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_57()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8163,7 +8422,7 @@ funct_group14_57()
 int
 funct_group14_59();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_58()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8191,7 +8450,7 @@ funct_group14_59()
 int
 funct_group14_61();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_60()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8205,7 +8464,7 @@ funct_group14_60()
 int
 funct_group14_62();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_61()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8219,7 +8478,7 @@ funct_group14_61()
 int
 funct_group14_63();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_62()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8247,7 +8506,7 @@ funct_group14_63()
 int
 funct_group14_65();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_64()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8261,7 +8520,7 @@ funct_group14_64()
 int
 funct_group14_66();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_65()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8275,7 +8534,7 @@ funct_group14_65()
 int
 funct_group14_67();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_66()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8303,7 +8562,7 @@ funct_group14_67()
 int
 funct_group14_69();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_68()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8317,7 +8576,7 @@ funct_group14_68()
 int
 funct_group14_70();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_69()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8331,7 +8590,7 @@ funct_group14_69()
 int
 funct_group14_71();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_70()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8359,7 +8618,7 @@ funct_group14_71()
 int
 funct_group14_73();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_72()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8373,7 +8632,7 @@ funct_group14_72()
 int
 funct_group14_74();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_73()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8387,7 +8646,7 @@ funct_group14_73()
 int
 funct_group14_75();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_74()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8415,7 +8674,7 @@ funct_group14_75()
 int
 funct_group14_77();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_76()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8429,7 +8688,7 @@ funct_group14_76()
 int
 funct_group14_78();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_77()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8443,7 +8702,7 @@ funct_group14_77()
 int
 funct_group14_79();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_78()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8471,7 +8730,7 @@ funct_group14_79()
 int
 funct_group14_81();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_80()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8485,7 +8744,7 @@ funct_group14_80()
 int
 funct_group14_82();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_81()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8499,7 +8758,7 @@ funct_group14_81()
 int
 funct_group14_83();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_82()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8527,7 +8786,7 @@ funct_group14_83()
 int
 funct_group14_85();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_84()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8541,7 +8800,7 @@ funct_group14_84()
 int
 funct_group14_86();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_85()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8555,7 +8814,7 @@ funct_group14_85()
 int
 funct_group14_87();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_86()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8583,7 +8842,7 @@ funct_group14_87()
 int
 funct_group14_89();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_88()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8597,7 +8856,7 @@ funct_group14_88()
 int
 funct_group14_90();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_89()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8611,7 +8870,7 @@ funct_group14_89()
 int
 funct_group14_91();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_90()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8639,7 +8898,7 @@ funct_group14_91()
 int
 funct_group14_93();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_92()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8653,7 +8912,7 @@ funct_group14_92()
 int
 funct_group14_94();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_93()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8667,7 +8926,7 @@ funct_group14_93()
 int
 funct_group14_95();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group14_94()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8697,7 +8956,7 @@ funct_group14_95()
 int
 funct_group15_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group15_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8725,7 +8984,7 @@ funct_group15_1()
 int
 funct_group15_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group15_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8753,7 +9012,7 @@ funct_group15_3()
 int
 funct_group15_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group15_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8783,7 +9042,7 @@ funct_group15_5()
 int
 funct_group16_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8811,7 +9070,7 @@ funct_group16_1()
 int
 funct_group16_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8839,7 +9098,7 @@ funct_group16_3()
 int
 funct_group16_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8867,7 +9126,7 @@ funct_group16_5()
 int
 funct_group16_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8895,7 +9154,7 @@ funct_group16_7()
 int
 funct_group16_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8923,7 +9182,7 @@ funct_group16_9()
 int
 funct_group16_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group16_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8953,7 +9212,7 @@ funct_group16_11()
 int
 funct_group17_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -8981,7 +9240,7 @@ funct_group17_1()
 int
 funct_group17_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9009,7 +9268,7 @@ funct_group17_3()
 int
 funct_group17_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9037,7 +9296,7 @@ funct_group17_5()
 int
 funct_group17_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9065,7 +9324,7 @@ funct_group17_7()
 int
 funct_group17_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9093,7 +9352,7 @@ funct_group17_9()
 int
 funct_group17_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9121,7 +9380,7 @@ funct_group17_11()
 int
 funct_group17_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9149,7 +9408,7 @@ funct_group17_13()
 int
 funct_group17_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9177,7 +9436,7 @@ funct_group17_15()
 int
 funct_group17_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9205,7 +9464,7 @@ funct_group17_17()
 int
 funct_group17_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9233,7 +9492,7 @@ funct_group17_19()
 int
 funct_group17_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9261,7 +9520,7 @@ funct_group17_21()
 int
 funct_group17_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group17_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9291,7 +9550,7 @@ funct_group17_23()
 int
 funct_group18_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9319,7 +9578,7 @@ funct_group18_1()
 int
 funct_group18_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9347,7 +9606,7 @@ funct_group18_3()
 int
 funct_group18_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9375,7 +9634,7 @@ funct_group18_5()
 int
 funct_group18_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9403,7 +9662,7 @@ funct_group18_7()
 int
 funct_group18_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9431,7 +9690,7 @@ funct_group18_9()
 int
 funct_group18_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9459,7 +9718,7 @@ funct_group18_11()
 int
 funct_group18_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9487,7 +9746,7 @@ funct_group18_13()
 int
 funct_group18_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9515,7 +9774,7 @@ funct_group18_15()
 int
 funct_group18_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9543,7 +9802,7 @@ funct_group18_17()
 int
 funct_group18_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9571,7 +9830,7 @@ funct_group18_19()
 int
 funct_group18_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9599,7 +9858,7 @@ funct_group18_21()
 int
 funct_group18_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9627,7 +9886,7 @@ funct_group18_23()
 int
 funct_group18_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9655,7 +9914,7 @@ funct_group18_25()
 int
 funct_group18_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9683,7 +9942,7 @@ funct_group18_27()
 int
 funct_group18_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9711,7 +9970,7 @@ funct_group18_29()
 int
 funct_group18_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9739,7 +9998,7 @@ funct_group18_31()
 int
 funct_group18_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9767,7 +10026,7 @@ funct_group18_33()
 int
 funct_group18_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9795,7 +10054,7 @@ funct_group18_35()
 int
 funct_group18_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9823,7 +10082,7 @@ funct_group18_37()
 int
 funct_group18_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9851,7 +10110,7 @@ funct_group18_39()
 int
 funct_group18_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9879,7 +10138,7 @@ funct_group18_41()
 int
 funct_group18_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9907,7 +10166,7 @@ funct_group18_43()
 int
 funct_group18_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9935,7 +10194,7 @@ funct_group18_45()
 int
 funct_group18_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group18_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9965,7 +10224,7 @@ funct_group18_47()
 int
 funct_group19_1();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_0()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -9993,7 +10252,7 @@ funct_group19_1()
 int
 funct_group19_3();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_2()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10021,7 +10280,7 @@ funct_group19_3()
 int
 funct_group19_5();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_4()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10049,7 +10308,7 @@ funct_group19_5()
 int
 funct_group19_7();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_6()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10077,7 +10336,7 @@ funct_group19_7()
 int
 funct_group19_9();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_8()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10105,7 +10364,7 @@ funct_group19_9()
 int
 funct_group19_11();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_10()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10133,7 +10392,7 @@ funct_group19_11()
 int
 funct_group19_13();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_12()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10161,7 +10420,7 @@ funct_group19_13()
 int
 funct_group19_15();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_14()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10189,7 +10448,7 @@ funct_group19_15()
 int
 funct_group19_17();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_16()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10217,7 +10476,7 @@ funct_group19_17()
 int
 funct_group19_19();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_18()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10245,7 +10504,7 @@ funct_group19_19()
 int
 funct_group19_21();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_20()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10273,7 +10532,7 @@ funct_group19_21()
 int
 funct_group19_23();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_22()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10301,7 +10560,7 @@ funct_group19_23()
 int
 funct_group19_25();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_24()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10329,7 +10588,7 @@ funct_group19_25()
 int
 funct_group19_27();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_26()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10357,7 +10616,7 @@ funct_group19_27()
 int
 funct_group19_29();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_28()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10385,7 +10644,7 @@ funct_group19_29()
 int
 funct_group19_31();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_30()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10413,7 +10672,7 @@ funct_group19_31()
 int
 funct_group19_33();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_32()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10441,7 +10700,7 @@ funct_group19_33()
 int
 funct_group19_35();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_34()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10469,7 +10728,7 @@ funct_group19_35()
 int
 funct_group19_37();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_36()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10497,7 +10756,7 @@ funct_group19_37()
 int
 funct_group19_39();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_38()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10525,7 +10784,7 @@ funct_group19_39()
 int
 funct_group19_41();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_40()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10553,7 +10812,7 @@ funct_group19_41()
 int
 funct_group19_43();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_42()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10581,7 +10840,7 @@ funct_group19_43()
 int
 funct_group19_45();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_44()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10609,7 +10868,7 @@ funct_group19_45()
 int
 funct_group19_47();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_46()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10637,7 +10896,7 @@ funct_group19_47()
 int
 funct_group19_49();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_48()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10665,7 +10924,7 @@ funct_group19_49()
 int
 funct_group19_51();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_50()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10693,7 +10952,7 @@ funct_group19_51()
 int
 funct_group19_53();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_52()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10721,7 +10980,7 @@ funct_group19_53()
 int
 funct_group19_55();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_54()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10749,7 +11008,7 @@ funct_group19_55()
 int
 funct_group19_57();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_56()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10777,7 +11036,7 @@ funct_group19_57()
 int
 funct_group19_59();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_58()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10805,7 +11064,7 @@ funct_group19_59()
 int
 funct_group19_61();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_60()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10833,7 +11092,7 @@ funct_group19_61()
 int
 funct_group19_63();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_62()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10861,7 +11120,7 @@ funct_group19_63()
 int
 funct_group19_65();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_64()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10889,7 +11148,7 @@ funct_group19_65()
 int
 funct_group19_67();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_66()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10917,7 +11176,7 @@ funct_group19_67()
 int
 funct_group19_69();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_68()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10945,7 +11204,7 @@ funct_group19_69()
 int
 funct_group19_71();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_70()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -10973,7 +11232,7 @@ funct_group19_71()
 int
 funct_group19_73();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_72()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11001,7 +11260,7 @@ funct_group19_73()
 int
 funct_group19_75();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_74()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11029,7 +11288,7 @@ funct_group19_75()
 int
 funct_group19_77();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_76()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11057,7 +11316,7 @@ funct_group19_77()
 int
 funct_group19_79();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_78()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11085,7 +11344,7 @@ funct_group19_79()
 int
 funct_group19_81();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_80()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11113,7 +11372,7 @@ funct_group19_81()
 int
 funct_group19_83();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_82()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11141,7 +11400,7 @@ funct_group19_83()
 int
 funct_group19_85();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_84()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11169,7 +11428,7 @@ funct_group19_85()
 int
 funct_group19_87();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_86()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11197,7 +11456,7 @@ funct_group19_87()
 int
 funct_group19_89();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_88()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11225,7 +11484,7 @@ funct_group19_89()
 int
 funct_group19_91();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_90()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11253,7 +11512,7 @@ funct_group19_91()
 int
 funct_group19_93();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_92()
 {
   volatile static std::uint32_t inner_side_effect = 0;
@@ -11281,7 +11540,7 @@ funct_group19_93()
 int
 funct_group19_95();
 
-[[gnu::section(".trivial_handle")]] int
+int
 funct_group19_94()
 {
   volatile static std::uint32_t inner_side_effect = 0;
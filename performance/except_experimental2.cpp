@@ -11,6 +11,9 @@
 #include <span>
 #include <string_view>
 
+#include "exception_allocator.hpp"
+#include "exception_globals.hpp"
+
 volatile std::int32_t side_effect = 0;
 std::uint32_t start_cycles = 0;
 std::uint32_t end_cycles = 0;
@@ -159,29 +162,32 @@ extern "C"
     return 1;
   }
 
-  std::array<std::uint8_t, 1024> storage;
-  std::span<std::uint8_t> storage_left(storage);
+  exception_allocator<EXCEPTION_POOL_SIZE> exception_pool;
   void* __wrap___cxa_allocate_exception(unsigned int p_size) // NOLINT
   {
-    // I only know this needs to be 128 because of the disassembly. I cannot
-    // figure out why its needed yet, but maybe the answer is in the
-    // libunwind-arm.cpp file.
-    static constexpr size_t offset = 128;
-    if (p_size + offset > storage_left.size()) {
-      return nullptr;
+    auto* memory = exception_pool.allocate(p_size);
+    if (memory == nullptr) {
+      // Same as libsupc++ once its emergency pool is exhausted
+      std::terminate();
     }
-    auto* memory = &storage_left[offset];
-    storage_left = storage_left.subspan(p_size + offset);
     return memory;
   }
-  void __wrap___cxa_free_exception(void*) // NOLINT
+  void __wrap___cxa_free_exception(void* p_thrown_object) // NOLINT
   {
-    storage_left = std::span<std::uint8_t>(storage);
+    exception_pool.free(p_thrown_object);
   }
   void __wrap___cxa_call_unexpected(void*) // NOLINT
   {
     std::terminate();
   }
+  void* __wrap___cxa_get_globals() // NOLINT
+  {
+    return exception_globals_hook();
+  }
+  void* __wrap___cxa_get_globals_fast() // NOLINT
+  {
+    return exception_globals_hook();
+  }
 #define USE_KHALIL_EXCEPTIONS 1
 
 #if USE_KHALIL_EXCEPTIONS == 1
@@ -0,0 +1,161 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares exception_allocator.hpp with the bump allocator the benchmarks
+// used before, which is what allocation_cycles in except_experimental.cpp
+// measured. Every row is one thrown object size. `single` is one allocation
+// and free, like allocation_cycles. `nested` keeps three exceptions alive
+// before freeing them in reverse, like a throw from a destructor during
+// cleanup, which the bump allocator cannot do. Each row gets a fresh pool,
+// blocks carved for one size stay in their class and would starve the next.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "exception_allocator.hpp"
+#include "platform.hpp"
+#include "statistics.hpp"
+
+std::uint32_t start_cycles = 0;
+std::uint32_t end_cycles = 0;
+
+int
+start();
+
+int
+main()
+{
+  dwt_counter_enable();
+  enable_flash_accelerator();
+  volatile int return_code = 0;
+  return_code = start();
+  benchmark_halt();
+  return return_code;
+}
+
+// The previous __wrap___cxa_allocate_exception. Any free resets the whole
+// arena.
+std::array<std::uint8_t, 1024> storage;
+std::span<std::uint8_t> storage_left(storage);
+
+[[gnu::noinline]] void*
+bump_allocate(std::size_t p_size)
+{
+  static constexpr std::size_t offset = 128;
+  if (p_size + offset > storage_left.size()) {
+    return nullptr;
+  }
+  auto* memory = &storage_left[offset];
+  storage_left = storage_left.subspan(p_size + offset);
+  return memory;
+}
+
+[[gnu::noinline]] void
+bump_free(void*)
+{
+  storage_left = std::span<std::uint8_t>(storage);
+}
+
+constexpr std::array<std::uint32_t, 5> sizes = { 4, 32, 128, 256, 512 };
+
+std::array<exception_allocator<EXCEPTION_POOL_SIZE>, sizes.size()> pools;
+exception_allocator<EXCEPTION_POOL_SIZE>* pool = pools.data();
+
+[[gnu::noinline]] void*
+pool_allocate(std::size_t p_size)
+{
+  return pool->allocate(p_size);
+}
+
+[[gnu::noinline]] void
+pool_free(void* p_thrown_object)
+{
+  pool->free(p_thrown_object);
+}
+
+constexpr std::size_t trial_count = p99_min_samples;
+constexpr std::size_t nested_depth = 3;
+
+std::array<std::uint32_t, trial_count> trial_cycles{};
+
+std::array<std::uint64_t, sizes.size()> thrown_sizes{};
+std::array<cycle_statistics, sizes.size()> bump_single{};
+std::array<cycle_statistics, sizes.size()> pool_single{};
+std::array<cycle_statistics, sizes.size()> pool_nested{};
+std::array<std::uint64_t, sizes.size()> pool_failures{};
+
+template<typename Allocate, typename Free>
+cycle_statistics
+measure_single(std::uint32_t p_size, Allocate p_allocate, Free p_free)
+{
+  for (auto& cycles : trial_cycles) {
+    start_cycles = uptime();
+    auto* memory = p_allocate(p_size);
+    if (memory != nullptr) {
+      p_free(memory);
+    }
+    end_cycles = uptime();
+    cycles = elapsed_cycles(start_cycles, end_cycles);
+  }
+  return summarize(trial_cycles);
+}
+
+cycle_statistics
+measure_nested(std::uint32_t p_size)
+{
+  std::array<void*, nested_depth> live{};
+  for (auto& cycles : trial_cycles) {
+    start_cycles = uptime();
+    for (auto& memory : live) {
+      memory = pool_allocate(p_size);
+    }
+    for (auto i = live.size(); i > 0; i--) {
+      if (live[i - 1] != nullptr) {
+        pool_free(live[i - 1]);
+      }
+    }
+    end_cycles = uptime();
+    cycles = elapsed_cycles(start_cycles, end_cycles);
+  }
+  return summarize(trial_cycles);
+}
+
+int
+start()
+{
+  measure_call_latency();
+
+  for (std::size_t row = 0; row < sizes.size(); row++) {
+    pool = &pools[row];
+    thrown_sizes[row] = sizes[row];
+    bump_single[row] = measure_single(sizes[row], bump_allocate, bump_free);
+    pool_single[row] = measure_single(sizes[row], pool_allocate, pool_free);
+    pool_nested[row] = measure_nested(sizes[row]);
+    pool_failures[row] = pool->failures;
+  }
+
+  export_csv("row,size,"
+             "bump_min,bump_median,bump_mean,bump_max,bump_p99,"
+             "pool_min,pool_median,pool_mean,pool_max,pool_p99,"
+             "nested_min,nested_median,nested_mean,nested_max,nested_p99,"
+             "failures",
+             thrown_sizes,
+             bump_single,
+             pool_single,
+             pool_nested,
+             pool_failures);
+  return 0;
+}
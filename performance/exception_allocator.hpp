@@ -0,0 +1,264 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <unwind.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <typeinfo>
+
+/// Bytes of RAM handed to __wrap___cxa_allocate_exception
+#if !defined(EXCEPTION_POOL_SIZE)
+#define EXCEPTION_POOL_SIZE 2048
+#endif
+
+/**
+ * @brief Layout of libsupc++'s __cxa_refcounted_exception
+ *
+ * Declared in unwind-cxx.h, which is not installed with the toolchain.
+ * __cxa_throw expects this header right before the thrown object, zeroed.
+ */
+struct cxa_refcounted_exception_layout
+{
+  int reference_count;
+  // __cxa_exception
+  std::type_info* exception_type;
+  void (*exception_destructor)(void*);
+  void (*unexpected_handler)();
+  void (*terminate_handler)();
+  void* next_exception;
+  int handler_count;
+#if defined(__ARM_EABI_UNWINDER__)
+  void* next_propagating_exception;
+  int propagation_count;
+#else
+  int handler_switch_value;
+  const unsigned char* action_record;
+  const unsigned char* language_specific_data;
+  _Unwind_Ptr catch_temp;
+  void* adjusted_ptr;
+#endif
+  _Unwind_Exception unwind_header;
+};
+
+constexpr std::size_t exception_header_size =
+  sizeof(cxa_refcounted_exception_layout);
+
+#if defined(__ARM_EABI_UNWINDER__)
+// The offset the bump allocator used to hard code
+static_assert(exception_header_size == 128);
+#endif
+
+/**
+ * @brief Exception object allocator with fixed size classes
+ *
+ * Each class keeps a free list of blocks. A class with an empty list carves
+ * a new block from the untouched end of the pool, so allocation and free are
+ * O(1) and any number of exceptions can be alive at once, as long as the pool
+ * holds them. Freed blocks stay in their class, they are never merged.
+ * Objects larger than the largest class fail like an exhausted pool.
+ *
+ * Lock free, so tasks and interrupts can throw at the same time. The free
+ * lists are stacks whose head packs the block with a tag that changes on
+ * every push and pop, so a compare and swap with a stale head fails even if
+ * the same block is on top again (ABA). The tag is 16 bits, a thread would
+ * have to be preempted for 65536 operations on one class for it to wrap. The
+ * carved end of the pool moves with a compare and swap as well. Everything
+ * is a 32 bit atomic, which ARMv7-M does with LDREX/STREX.
+ *
+ * @tparam pool_size - bytes of storage, including the block headers
+ */
+template<std::size_t pool_size>
+class exception_allocator
+{
+public:
+  /// Largest thrown object of each class, the block adds the exception
+  /// header and a free list link
+  static constexpr std::array<std::size_t, 3> payload_classes = {
+    32,
+    128,
+    512,
+  };
+
+  /**
+   * @brief Allocate the storage of a thrown object
+   *
+   * @return the thrown object with a zeroed exception header in front of
+   * it, nullptr if the pool is exhausted
+   */
+  void* allocate(std::size_t p_thrown_size)
+  {
+    std::size_t size_class = 0;
+    while (size_class < payload_classes.size() &&
+           payload_classes[size_class] < p_thrown_size) {
+      size_class++;
+    }
+
+    block* result = nullptr;
+    // Take a free block of the class, carve one, or fall back to a free
+    // block of a larger class.
+    for (auto index = size_class; index < payload_classes.size(); index++) {
+      result = pop(index);
+      if (result != nullptr) {
+        break;
+      }
+      if (index == size_class) {
+        result = carve(index);
+        if (result != nullptr) {
+          break;
+        }
+      }
+    }
+
+    if (result == nullptr) {
+      // Too large for every class, or the pool is exhausted
+      failures.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    raise(high_water, live.fetch_add(1, std::memory_order_relaxed) + 1);
+    raise(high_water_bytes, m_carved.load(std::memory_order_relaxed));
+
+    auto* header = reinterpret_cast<std::uint8_t*>(result + 1);
+    std::memset(header, 0, exception_header_size);
+    return header + exception_header_size;
+  }
+
+  void free(void* p_thrown_object)
+  {
+    auto* header =
+      static_cast<std::uint8_t*>(p_thrown_object) - exception_header_size;
+    auto* freed = reinterpret_cast<block*>(header) - 1;
+    push(freed->size_class, freed);
+    live.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /// Exceptions allocated and not freed yet
+  std::atomic<std::uint32_t> live = 0;
+  /// Most exceptions alive at once
+  std::atomic<std::uint32_t> high_water = 0;
+  /// Bytes of the pool carved into blocks, they are never given back
+  std::atomic<std::uint32_t> high_water_bytes = 0;
+  std::atomic<std::uint32_t> allocations = 0;
+  /// Allocations that did not fit the pool
+  std::atomic<std::uint32_t> failures = 0;
+
+private:
+  struct block
+  {
+    /// Link of the next free block of the same class, unused while
+    /// allocated. Atomic because a pop that loses its race may read it
+    /// while the winner reuses the block.
+    std::atomic<std::uint32_t> next = 0;
+    std::uint32_t size_class = 0;
+  };
+
+  static constexpr std::size_t align = alignof(std::max_align_t) > 8
+                                         ? alignof(std::max_align_t)
+                                         : 8;
+  static_assert(sizeof(block) <= align);
+  static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+  /// A link is the block's offset in the pool in units of `align`, plus 1
+  /// so that 0 ends a list. List heads keep their tag above it.
+  static constexpr std::uint32_t link_mask = 0xFFFF;
+  static constexpr std::uint32_t tag_increment = link_mask + 1;
+  static_assert(pool_size / align < link_mask);
+
+  static constexpr std::size_t block_size(std::size_t p_size_class)
+  {
+    auto size = align + exception_header_size + payload_classes[p_size_class];
+    return (size + align - 1) & ~(align - 1);
+  }
+
+  /// The link sits right before the header so the header stays aligned
+  block* block_at(std::uint32_t p_offset)
+  {
+    return reinterpret_cast<block*>(&m_pool[p_offset + align] -
+                                    sizeof(block));
+  }
+
+  std::uint32_t link_of(block* p_block)
+  {
+    auto offset = reinterpret_cast<std::uint8_t*>(p_block) + sizeof(block) -
+                  align - m_pool.data();
+    return offset / align + 1;
+  }
+
+  static void raise(std::atomic<std::uint32_t>& p_mark, std::uint32_t p_value)
+  {
+    auto mark = p_mark.load(std::memory_order_relaxed);
+    while (mark < p_value && !p_mark.compare_exchange_weak(
+                               mark, p_value, std::memory_order_relaxed)) {
+    }
+  }
+
+  block* pop(std::size_t p_size_class)
+  {
+    auto& list = m_free[p_size_class];
+    auto head = list.load(std::memory_order_acquire);
+    while ((head & link_mask) != 0) {
+      auto* top = block_at(((head & link_mask) - 1) * align);
+      auto next = ((head & ~link_mask) + tag_increment) |
+                  top->next.load(std::memory_order_relaxed);
+      if (list.compare_exchange_weak(head,
+                                     next,
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+        return top;
+      }
+    }
+    return nullptr;
+  }
+
+  void push(std::size_t p_size_class, block* p_block)
+  {
+    auto& list = m_free[p_size_class];
+    auto head = list.load(std::memory_order_relaxed);
+    std::uint32_t next = 0;
+    do {
+      p_block->next.store(head & link_mask, std::memory_order_relaxed);
+      next = ((head & ~link_mask) + tag_increment) | link_of(p_block);
+    } while (!list.compare_exchange_weak(
+      head, next, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  block* carve(std::size_t p_size_class)
+  {
+    auto size = block_size(p_size_class);
+    auto carved = m_carved.load(std::memory_order_relaxed);
+    do {
+      if (size > pool_size - carved) {
+        return nullptr;
+      }
+    } while (!m_carved.compare_exchange_weak(
+      carved, carved + size, std::memory_order_relaxed));
+
+    auto* result = new (block_at(carved)) block{};
+    result->size_class = p_size_class;
+    return result;
+  }
+
+  alignas(std::max_align_t) std::array<std::uint8_t, pool_size> m_pool{};
+  /// Head of each free list: tag in the upper half, link in the lower
+  std::array<std::atomic<std::uint32_t>, payload_classes.size()> m_free{};
+  std::atomic<std::uint32_t> m_carved = 0;
+};
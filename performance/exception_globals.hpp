@@ -0,0 +1,56 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/**
+ * @brief Layout of libsupc++'s __cxa_eh_globals
+ *
+ * Declared in unwind-cxx.h, which is not installed with the toolchain.
+ */
+struct cxa_eh_globals_layout
+{
+  void* caught_exceptions;
+  unsigned int uncaught_exceptions;
+#if defined(__ARM_EABI_UNWINDER__)
+  void* propagating_exceptions;
+#endif
+};
+
+/// Globals of a program with a single thread
+inline cxa_eh_globals_layout main_thread_exception_globals{};
+
+inline cxa_eh_globals_layout*
+single_thread_exception_globals()
+{
+  return &main_thread_exception_globals;
+}
+
+/**
+ * @brief Returns the __cxa_eh_globals of the calling thread
+ *
+ * The runtimes link with -Wl,--wrap=__cxa_get_globals and
+ * -Wl,--wrap=__cxa_get_globals_fast and their wrappers return this hook.
+ * The bare metal libsupc++ is built without threads and keeps one set of
+ * globals for the whole program. That breaks as soon as two tasks are in a
+ * throw at once: the caught exception stack and uncaught count mix, and on
+ * ARM the __cxa_end_cleanup of one task pops the exception that
+ * __cxa_begin_cleanup of another pushed.
+ *
+ * An RTOS points the hook at thread local storage before any task throws,
+ * for example a slot of pvTaskGetThreadLocalStoragePointer() with FreeRTOS.
+ * Each thread needs its own zeroed cxa_eh_globals_layout.
+ */
+inline cxa_eh_globals_layout* (*exception_globals_hook)() =
+  single_thread_exception_globals;
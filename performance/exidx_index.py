@@ -0,0 +1,192 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Post-link tool that fills in the `.exidx_index` section of an ELF.
+
+Every `.ARM.exidx` entry stores its function start as a prel31 offset relative
+to the entry itself, so `search_EIT_table` has to decode two of them for every
+probe. The linker script reserves `.exidx_index` right after the exception
+index and this tool writes the already decoded, absolute function start
+addresses into it, in the same order as `.ARM.exidx`:
+
+    struct exidx_index_header {
+        uint32_t layout;  // 0 until this tool has been run
+        uint32_t count;   // number of .ARM.exidx entries
+        uint32_t base;    // lowest function address (compact layout only)
+    };
+    // followed by `count` keys
+
+Layouts:
+
+    sorted   - uint32_t absolute function start addresses
+    compact  - uint16_t (address - base) / 2, for images where every function
+               lies within 128KiB of the first one
+    eytzinger - uint32_t keys[count + 1] in breadth first (Eytzinger) order
+               starting at keys[1], followed by uint16_t ranks[count + 1]
+               where ranks[k] is the .ARM.exidx index of keys[k] and
+               ranks[0] is count
+
+Usage:
+
+    python3 exidx_index.py build/MinSizeRel/except_experimental.elf
+"""
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+from typing import List
+
+from elf_reader import elf_file
+
+LAYOUT_SORTED = 1
+LAYOUT_COMPACT = 2
+LAYOUT_EYTZINGER = 3
+
+_IDX_TABLE_ENTRY_FORMAT = "<II"
+_IDX_TABLE_ENTRY_SIZE = struct.calcsize(_IDX_TABLE_ENTRY_FORMAT)
+_HEADER_FORMAT = "<III"
+
+
+def selfrel_offset31(offset: int, address: int) -> int:
+    # Sign extend to 32 bits.
+    if offset & (1 << 30):
+        offset |= 1 << 31
+    else:
+        offset &= ~(1 << 31)
+    return (offset + address) & 0xFFFFFFFF
+
+
+def read_function_starts(elf: elf_file) -> List[int]:
+    start = elf.symbol("__exidx_start")
+    end = elf.symbol("__exidx_end")
+    if start is None or end is None:
+        raise RuntimeError("__exidx_start/__exidx_end not found, is this an "
+                           "ARM EHABI image linked with standard_arm.ld?")
+
+    table = elf.read(start.value, end.value - start.value)
+    function_starts = []
+    for index in range(len(table) // _IDX_TABLE_ENTRY_SIZE):
+        entry_address = start.value + index * _IDX_TABLE_ENTRY_SIZE
+        fnoffset, _ = struct.unpack_from(_IDX_TABLE_ENTRY_FORMAT, table,
+                                         index * _IDX_TABLE_ENTRY_SIZE)
+        function_starts.append(selfrel_offset31(fnoffset, entry_address))
+
+    if function_starts != sorted(function_starts):
+        raise RuntimeError(".ARM.exidx is not sorted by function address")
+
+    return function_starts
+
+
+def build_sorted(function_starts: List[int]) -> bytes:
+    header = struct.pack(_HEADER_FORMAT, LAYOUT_SORTED,
+                         len(function_starts), 0)
+    return header + struct.pack(f"<{len(function_starts)}I", *function_starts)
+
+
+def build_compact(function_starts: List[int]) -> bytes:
+    base = function_starts[0] if function_starts else 0
+    deltas = [(address - base) >> 1 for address in function_starts]
+    if deltas and deltas[-1] > 0xFFFF:
+        raise RuntimeError(
+            f"functions span 0x{function_starts[-1] - base:x} bytes which "
+            "does not fit the compact layout, use --layout sorted")
+    header = struct.pack(_HEADER_FORMAT, LAYOUT_COMPACT,
+                         len(function_starts), base)
+    return header + struct.pack(f"<{len(deltas)}H", *deltas)
+
+
+def eytzinger_order(count: int) -> List[int]:
+    """Sorted index stored at each Eytzinger position 1..count"""
+    order = [0] * (count + 1)
+    next_rank = 0
+
+    # In-order walk of the implicit tree visits the positions in sorted order
+    stack = []
+    position = 1
+    while stack or position <= count:
+        while position <= count:
+            stack.append(position)
+            position = 2 * position
+        position = stack.pop()
+        order[position] = next_rank
+        next_rank += 1
+        position = 2 * position + 1
+
+    return order
+
+
+def build_eytzinger(function_starts: List[int]) -> bytes:
+    count = len(function_starts)
+    if count > 0xFFFF:
+        raise RuntimeError(f"{count} entries do not fit the 16-bit ranks of "
+                           "the eytzinger layout, use --layout sorted")
+    header = struct.pack(_HEADER_FORMAT, LAYOUT_EYTZINGER, count, 0)
+    if count == 0:
+        return header
+
+    order = eytzinger_order(count)
+    keys = [0] + [function_starts[rank] for rank in order[1:]]
+    ranks = [count] + order[1:]
+    return (header + struct.pack(f"<{count + 1}I", *keys) +
+            struct.pack(f"<{count + 1}H", *ranks))
+
+
+LAYOUTS = {
+    "sorted": build_sorted,
+    "compact": build_compact,
+    "eytzinger": build_eytzinger,
+}
+
+
+def patch(elf: elf_file, payload: bytes):
+    start = elf.symbol("__exidx_index_start")
+    end = elf.symbol("__exidx_index_end")
+    if start is None or end is None:
+        raise RuntimeError("__exidx_index_start/__exidx_index_end not found, "
+                           "the linker script must reserve .exidx_index and "
+                           "the application must reference it")
+
+    reserved = end.value - start.value
+    if len(payload) > reserved:
+        raise RuntimeError(f"index needs {len(payload)} bytes but only "
+                           f"{reserved} bytes are reserved")
+
+    elf.write(start.value, payload)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Write absolute function start addresses of .ARM.exidx "
+                    "into the .exidx_index section of an ELF, in place")
+    parser.add_argument("elf", type=Path)
+    parser.add_argument("-l", "--layout", choices=LAYOUTS.keys(),
+                        default="sorted")
+    args = parser.parse_args()
+
+    try:
+        elf = elf_file(args.elf)
+        function_starts = read_function_starts(elf)
+        payload = LAYOUTS[args.layout](function_starts)
+        patch(elf, payload)
+        elf.save()
+    except RuntimeError as error:
+        print(f"{args.elf}: {error}", file=sys.stderr)
+        sys.exit(1)
+
+    print(f"{args.elf}: indexed {len(function_starts)} functions "
+          f"({args.layout}, {len(payload)} bytes)")
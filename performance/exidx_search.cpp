@@ -0,0 +1,334 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the .ARM.exidx search algorithms of except_experimental.cpp over
+// synthetic exception index tables with 100 to 50k entries.
+//
+// Every table and index is computed at compile time and lives in flash like
+// the real .ARM.exidx and .exidx_index sections. The function start of entry
+// i is stored as a prel31 offset relative to the entry itself, so the tables
+// can be built without knowing where they will be linked: the synthetic
+// functions sit `text_gap` bytes before each table.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "exidx_search.hpp"
+#include "platform.hpp"
+#include "statistics.hpp"
+
+std::uint32_t start_cycles = 0;
+std::uint32_t end_cycles = 0;
+
+int
+start();
+
+int
+main()
+{
+  dwt_counter_enable();
+  enable_flash_accelerator();
+  volatile int return_code = 0;
+  return_code = start();
+  benchmark_halt();
+  return return_code;
+}
+
+constexpr std::uint32_t exidx_cantunwind = 1;
+// Offset of the first synthetic function, so there are addresses before it
+constexpr std::uint32_t first_function = 0x100;
+
+constexpr std::uint32_t
+next_random(std::uint32_t p_state)
+{
+  return p_state * 1664525u + 1013904223u;
+}
+
+template<std::size_t count>
+struct search_table
+{
+  std::array<__EIT_entry, count> entries{};
+  // Offset of each function from the start of the synthetic .text
+  std::array<std::uint32_t, count> offsets{};
+  std::uint32_t text_end = 0;
+  std::uint32_t text_gap = 0;
+  bool fits_compact = false;
+
+  // Each index is a header directly followed by its keys, just like
+  // .exidx_index, see exidx_index.py for the layouts.
+  struct
+  {
+    exidx_index_header header{};
+    std::array<std::uint32_t, count> keys{};
+  } sorted{};
+  struct
+  {
+    exidx_index_header header{};
+    std::array<std::uint16_t, count> keys{};
+  } compact{};
+  struct
+  {
+    exidx_index_header header{};
+    std::array<std::uint32_t, count + 1> keys{};
+    std::array<std::uint16_t, count + 1> ranks{};
+  } eytzinger{};
+};
+
+template<std::size_t count>
+constexpr void
+fill_eytzinger(search_table<count>& p_table,
+               std::size_t p_position,
+               std::size_t& p_rank)
+{
+  if (p_position > count) {
+    return;
+  }
+  fill_eytzinger(p_table, 2 * p_position, p_rank);
+  p_table.eytzinger.keys[p_position] = p_table.offsets[p_rank];
+  p_table.eytzinger.ranks[p_position] = p_rank;
+  p_rank++;
+  fill_eytzinger(p_table, 2 * p_position + 1, p_rank);
+}
+
+template<std::size_t count>
+constexpr search_table<count>
+make_search_table()
+{
+  static_assert(count <= 0xFFFF, "eytzinger ranks are 16-bit");
+  search_table<count> table;
+
+  std::uint32_t random = count;
+  std::uint32_t offset = first_function;
+  for (std::size_t i = 0; i < count; i++) {
+    table.offsets[i] = offset;
+    random = next_random(random);
+    // At least 8 bytes per function keeps the raw prel31 offsets increasing,
+    // which search_prel31_relative and search_upper_bound rely on.
+    offset += 8 + 2 * ((random >> 16) % 64);
+  }
+  table.text_end = offset;
+  table.text_gap = offset + first_function;
+
+  for (std::size_t i = 0; i < count; i++) {
+    // The function lives at (&entries[0] - text_gap + offsets[i]) and the
+    // entry at (&entries[0] + 8 * i).
+    auto entry_offset = static_cast<std::uint32_t>(i * sizeof(__EIT_entry));
+    std::uint32_t relative = table.offsets[i] - table.text_gap - entry_offset;
+    table.entries[i].fnoffset = relative & ~(1u << 31);
+    table.entries[i].content = exidx_cantunwind;
+  }
+
+  constexpr auto count_u32 = static_cast<std::uint32_t>(count);
+  table.sorted.header = { exidx_index_sorted, count_u32, 0 };
+  table.sorted.keys = table.offsets;
+
+  table.fits_compact = ((table.offsets[count - 1] >> 1) <= 0xFFFF);
+  table.compact.header = { exidx_index_compact, count_u32, 0 };
+  for (std::size_t i = 0; table.fits_compact && i < count; i++) {
+    table.compact.keys[i] = table.offsets[i] >> 1;
+  }
+
+  std::size_t rank = 0;
+  table.eytzinger.header = { exidx_index_eytzinger, count_u32, 0 };
+  table.eytzinger.ranks[0] = count;
+  fill_eytzinger(table, 1, rank);
+
+  return table;
+}
+
+// Type erased view of one search_table so the algorithms are not
+// instantiated per table size.
+struct search_table_view
+{
+  std::uint32_t count;
+  const __EIT_entry* entries;
+  const exidx_index_header* sorted;
+  const exidx_index_header* compact;
+  const exidx_index_header* eytzinger;
+  std::uint32_t text_end;
+  std::uint32_t text_gap;
+  bool fits_compact;
+};
+
+template<std::size_t count>
+search_table_view
+make_view(const search_table<count>& p_table)
+{
+  return {
+    .count = count,
+    .entries = p_table.entries.data(),
+    .sorted = &p_table.sorted.header,
+    .compact = &p_table.compact.header,
+    .eytzinger = &p_table.eytzinger.header,
+    .text_end = p_table.text_end,
+    .text_gap = p_table.text_gap,
+    .fits_compact = p_table.fits_compact,
+  };
+}
+
+#if BENCHMARK_QEMU
+// All sizes together need ~1.6MiB of flash, only the QEMU image has that
+constexpr auto table_100 = make_search_table<100>();
+constexpr auto table_500 = make_search_table<500>();
+constexpr auto table_1000 = make_search_table<1000>();
+constexpr auto table_5000 = make_search_table<5000>();
+constexpr auto table_10000 = make_search_table<10000>();
+constexpr auto table_50000 = make_search_table<50000>();
+
+const std::array tables = {
+  make_view(table_100),   make_view(table_500),   make_view(table_1000),
+  make_view(table_5000),  make_view(table_10000), make_view(table_50000),
+};
+#else
+// The LPC4078 has 512KiB of flash
+constexpr auto table_100 = make_search_table<100>();
+constexpr auto table_500 = make_search_table<500>();
+constexpr auto table_1000 = make_search_table<1000>();
+constexpr auto table_2500 = make_search_table<2500>();
+constexpr auto table_5000 = make_search_table<5000>();
+
+const std::array tables = {
+  make_view(table_100),  make_view(table_500),  make_view(table_1000),
+  make_view(table_2500), make_view(table_5000),
+};
+#endif
+
+// Each search takes the offset of the address from the synthetic .text and
+// converts it to the address space it searches.
+using search_function = const __EIT_entry*(const search_table_view&,
+                                           std::uint32_t);
+
+std::uint32_t
+prel31_address(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return reinterpret_cast<std::uint32_t>(p_table.entries) - p_table.text_gap +
+         p_offset;
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_prel31_table(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_prel31_table(
+    p_table.entries, p_table.count, prel31_address(p_table, p_offset));
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_prel31_relative(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_prel31_relative(
+    p_table.entries, p_table.count, prel31_address(p_table, p_offset));
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_upper_bound(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_upper_bound(
+    p_table.entries, p_table.count, prel31_address(p_table, p_offset));
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_sorted_index(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_sorted_index(p_table.entries, *p_table.sorted, p_offset);
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_compact_index(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_compact_index(p_table.entries, *p_table.compact, p_offset);
+}
+
+[[gnu::noinline]] const __EIT_entry*
+run_eytzinger_index(const search_table_view& p_table, std::uint32_t p_offset)
+{
+  return search_eytzinger_index(p_table.entries, *p_table.eytzinger, p_offset);
+}
+
+struct algorithm
+{
+  std::string_view name;
+  search_function* search;
+};
+
+// Same numbering as SEARCH_ALGORITHM in except_experimental.cpp, the
+// compact layout is the EXIDX_INDEX_COMPACT variant of 3.
+constexpr std::array<algorithm, 6> algorithms = { {
+  { "0:prel31", run_prel31_table },
+  { "1:prel31_relative", run_prel31_relative },
+  { "2:upper_bound", run_upper_bound },
+  { "3:sorted_index", run_sorted_index },
+  { "3:compact_index", run_compact_index },
+  { "4:eytzinger_index", run_eytzinger_index },
+} };
+
+constexpr std::size_t query_count = 128;
+constexpr std::size_t max_rows = tables.size() * algorithms.size();
+
+std::array<std::uint32_t, query_count> queries{};
+std::array<std::uint32_t, query_count> query_cycles{};
+
+std::array<std::uint64_t, max_rows> entry_counts{};
+std::array<std::string_view, max_rows> algorithm_names{};
+std::array<cycle_statistics, max_rows> search_stats{};
+std::array<std::uint64_t, max_rows> mismatches{};
+
+int
+start()
+{
+  measure_call_latency();
+
+  std::size_t row = 0;
+  std::uint32_t random = 0x1234'5678;
+  for (const auto& table : tables) {
+    // Addresses before the first function are left out, search_upper_bound
+    // does not handle them.
+    for (auto& query : queries) {
+      random = next_random(random);
+      query = first_function + (random % (table.text_end - first_function));
+    }
+
+    for (const auto& [name, search] : algorithms) {
+      if (search == run_compact_index && !table.fits_compact) {
+        continue;
+      }
+
+      std::uint64_t wrong = 0;
+      for (std::size_t i = 0; i < query_count; i++) {
+        start_cycles = uptime();
+        const auto* entry = search(table, queries[i]);
+        end_cycles = uptime();
+        query_cycles[i] = elapsed_cycles(start_cycles, end_cycles);
+        if (entry != run_prel31_table(table, queries[i])) {
+          wrong++;
+        }
+      }
+
+      entry_counts[row] = table.count;
+      algorithm_names[row] = name;
+      search_stats[row] = summarize(query_cycles);
+      mismatches[row] = wrong;
+      row++;
+    }
+  }
+
+  export_csv("row,entries,algorithm,min,median,mean,max,p99,mismatches",
+             std::span(entry_counts).first(row),
+             std::span(algorithm_names).first(row),
+             std::span(search_stats).first(row),
+             std::span(mismatches).first(row));
+  return 0;
+}
@@ -0,0 +1,238 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// Searches that map a return address to its .ARM.exidx entry. Shared by the
+// search_EIT_table replacement in except_experimental.cpp and the
+// exidx_search.cpp benchmark.
+
+typedef struct __EIT_entry // NOLINT
+{
+  std::uint32_t fnoffset;
+  std::uint32_t content;
+} __EIT_entry;
+
+inline std::uint32_t
+selfrel_offset31(const std::uint32_t* p)
+{
+  std::uint32_t offset;
+
+  offset = *p;
+  /* Sign extend to 32 bits.  */
+  if (offset & (1 << 30))
+    offset |= 1u << 31;
+  else
+    offset &= ~(1u << 31);
+
+  return offset + (std::uint32_t)p;
+}
+
+struct eit_entry_less_than
+{
+  [[gnu::always_inline]] static std::uint32_t to_prel31_offset(
+    const __EIT_entry& entry,
+    std::uint32_t address)
+  {
+    std::uint32_t entry_addr = reinterpret_cast<std::uint32_t>(&entry);
+    std::uint32_t final_address = (address - entry_addr) & ~(1 << 31);
+    return final_address;
+  }
+
+  bool operator()(const __EIT_entry& left, const __EIT_entry& right)
+  {
+    return left.fnoffset < right.fnoffset;
+  }
+  bool operator()(const __EIT_entry& left, std::uint32_t right)
+  {
+    std::uint32_t final_address = to_prel31_offset(left, right);
+    return left.fnoffset < final_address;
+  }
+  bool operator()(std::uint32_t left, const __EIT_entry& right)
+  {
+    std::uint32_t final_address = to_prel31_offset(right, left);
+    return final_address < right.fnoffset;
+  }
+};
+
+// Layout of the .exidx_index section, see exidx_index.py
+struct exidx_index_header
+{
+  std::uint32_t layout;
+  std::uint32_t count;
+  std::uint32_t base;
+};
+
+constexpr std::uint32_t exidx_index_sorted = 1;
+constexpr std::uint32_t exidx_index_compact = 2;
+constexpr std::uint32_t exidx_index_eytzinger = 3;
+
+/**
+ * @brief libgcc's search, decodes two prel31 offsets per probe
+ */
+[[gnu::always_inline]] inline const __EIT_entry*
+search_prel31_table(const __EIT_entry* table,
+                    int nrec, // NOLINT
+                    std::uint32_t return_address)
+{
+  int left = 0;
+  int right = nrec - 1;
+  while (true) {
+    int n = (left + right) / 2;
+    std::uint32_t next_fn = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t this_fn = selfrel_offset31(&table[n].fnoffset);
+
+    if (n != nrec - 1) {
+      next_fn = selfrel_offset31(&table[n + 1].fnoffset) - 1;
+    }
+
+    if (return_address < this_fn) {
+      if (n == left) {
+        return nullptr;
+      }
+      right = n - 1;
+    } else if (return_address <= next_fn) {
+      return &table[n];
+    } else {
+      left = n + 1;
+    }
+  }
+}
+
+/**
+ * @brief Converts the return address to a prel31 offset for each probe
+ * instead of decoding the entries
+ */
+[[gnu::always_inline]] inline const __EIT_entry*
+search_prel31_relative(const __EIT_entry* table,
+                       int nrec, // NOLINT
+                       std::uint32_t return_address)
+{
+  int left = 0;
+  int right = nrec - 1;
+
+  while (true) {
+    int n = (left + right) / 2;
+    std::uint32_t next_fn = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t this_fn = table[n].fnoffset;
+
+    if (n != nrec - 1) {
+      next_fn = table[n + 1].fnoffset - 1;
+    }
+
+    std::uint32_t prel31 =
+      return_address - reinterpret_cast<std::uint32_t>(&table[n]);
+    // clear MSB to conform to the prel31 fnoffset format
+    prel31 = prel31 & ~(1 << 31);
+
+    if (prel31 < this_fn) {
+      if (n == left) {
+        return nullptr;
+      }
+      right = n - 1;
+    } else if (prel31 <= next_fn) {
+      return &table[n];
+    } else {
+      left = n + 1;
+    }
+  }
+}
+
+[[gnu::always_inline]] inline const __EIT_entry*
+search_upper_bound(const __EIT_entry* table,
+                   int nrec, // NOLINT
+                   std::uint32_t return_address)
+{
+  std::span<const __EIT_entry> table_span(table, nrec);
+  const auto& entry = std::upper_bound(table_span.begin(),
+                                       table_span.end(),
+                                       return_address,
+                                       eit_entry_less_than{});
+  return &(*(entry - 1));
+}
+
+/**
+ * @brief upper_bound over the u32 absolute addresses of the sorted layout
+ */
+[[gnu::always_inline]] inline const __EIT_entry*
+search_sorted_index(const __EIT_entry* table,
+                    const exidx_index_header& index,
+                    std::uint32_t return_address)
+{
+  const auto* keys = reinterpret_cast<const std::uint32_t*>(&index + 1);
+  const auto* position =
+    std::upper_bound(keys, keys + index.count, return_address);
+  if (position == keys) {
+    return nullptr;
+  }
+  return &table[(position - keys) - 1];
+}
+
+/**
+ * @brief upper_bound over the u16 half-word offsets of the compact layout
+ */
+[[gnu::always_inline]] inline const __EIT_entry*
+search_compact_index(const __EIT_entry* table,
+                     const exidx_index_header& index,
+                     std::uint32_t return_address)
+{
+  if (return_address < index.base) {
+    return nullptr;
+  }
+  const auto* keys = reinterpret_cast<const std::uint16_t*>(&index + 1);
+  std::uint32_t key = (return_address - index.base) >> 1;
+  const auto* position = std::upper_bound(keys, keys + index.count, key);
+  if (position == keys) {
+    return nullptr;
+  }
+  return &table[(position - keys) - 1];
+}
+
+/**
+ * @brief Branchless search over the Eytzinger layout
+ *
+ * keys[1..count] hold the function addresses in breadth first order of an
+ * implicit binary tree, so the first levels of every search share the same
+ * flash lines. ranks[k] is the .ARM.exidx index of keys[k] and ranks[0] is
+ * count, which is where a search ends that never turned left.
+ */
+[[gnu::always_inline]] inline const __EIT_entry*
+search_eytzinger_index(const __EIT_entry* table,
+                       const exidx_index_header& index,
+                       std::uint32_t return_address)
+{
+  const auto* keys = reinterpret_cast<const std::uint32_t*>(&index + 1);
+  const auto* ranks =
+    reinterpret_cast<const std::uint16_t*>(keys + index.count + 1);
+
+  std::uint32_t k = 1;
+  while (k <= index.count) {
+    k = 2 * k + (keys[k] <= return_address);
+  }
+  // Drop the right turns taken after the last left turn, which leaves the
+  // node of the first key greater than return_address.
+  k >>= std::countr_one(k) + 1;
+
+  std::uint32_t rank = ranks[k];
+  if (rank == 0) {
+    return nullptr;
+  }
+  return &table[rank - 1];
+}
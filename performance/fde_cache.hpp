@@ -0,0 +1,374 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <link.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+// Lock free FDE lookup for hosted (Linux, 64 bit) builds.
+//
+// libgcc's _Unwind_Find_FDE finds the object of every frame with
+// dl_iterate_phdr, which holds the loader lock, or with _dl_find_object on
+// glibc 2.35 and later, and then binary searches its .eh_frame_hdr. This
+// snapshots the .eh_frame_hdr search table of every loaded object once. The
+// snapshot is immutable, so any number of threads search it without a lock
+// or a shared write.
+//
+// Link libgcc's unwinder statically (-static-libgcc -static-libstdc++) with
+// -Wl,--wrap=_Unwind_Find_FDE and forward the wrapper to fde_cache_find().
+// Anything the snapshot cannot answer goes to __real__Unwind_Find_FDE, so
+// objects loaded later still unwind. Call fde_cache_refresh() after dlclose,
+// older snapshots are never freed because a thread may still be searching
+// them.
+
+/// Layout of libgcc's dwarf_eh_bases, unwind-dw2-fde.h is not installed
+struct dwarf_eh_bases
+{
+  void* tbase;
+  void* dbase;
+  void* func;
+};
+
+extern "C" const void* __real__Unwind_Find_FDE(void* p_pc,
+                                               dwarf_eh_bases* p_bases);
+
+namespace fde_detail {
+// Pointer encodings of the DWARF exception header, see LSB 5.0 10.5
+constexpr std::uint8_t pe_absptr = 0x00;
+constexpr std::uint8_t pe_uleb128 = 0x01;
+constexpr std::uint8_t pe_udata2 = 0x02;
+constexpr std::uint8_t pe_udata4 = 0x03;
+constexpr std::uint8_t pe_udata8 = 0x04;
+constexpr std::uint8_t pe_sleb128 = 0x09;
+constexpr std::uint8_t pe_sdata2 = 0x0A;
+constexpr std::uint8_t pe_sdata4 = 0x0B;
+constexpr std::uint8_t pe_sdata8 = 0x0C;
+constexpr std::uint8_t pe_pcrel = 0x10;
+constexpr std::uint8_t pe_datarel = 0x30;
+constexpr std::uint8_t pe_omit = 0xFF;
+/// What every linker writes for the .eh_frame_hdr search table
+constexpr std::uint8_t table_encoding = pe_datarel | pe_sdata4;
+
+template<typename T>
+inline T
+read(const std::uint8_t*& p_data)
+{
+  T value;
+  std::memcpy(&value, p_data, sizeof(T));
+  p_data += sizeof(T);
+  return value;
+}
+
+inline std::uint64_t
+read_uleb128(const std::uint8_t*& p_data)
+{
+  std::uint64_t value = 0;
+  unsigned shift = 0;
+  std::uint8_t byte = 0;
+  do {
+    byte = *p_data++;
+    value |= std::uint64_t{ byte & 0x7Fu } << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return value;
+}
+
+inline std::int64_t
+read_sleb128(const std::uint8_t*& p_data)
+{
+  std::uint64_t value = 0;
+  unsigned shift = 0;
+  std::uint8_t byte = 0;
+  do {
+    byte = *p_data++;
+    value |= std::uint64_t{ byte & 0x7Fu } << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  if (shift < 64 && (byte & 0x40)) {
+    value |= ~std::uint64_t{ 0 } << shift;
+  }
+  return static_cast<std::int64_t>(value);
+}
+
+/**
+ * @brief Reads a pointer of encoding p_encoding
+ *
+ * Only absolute and pc relative pointers, which is all that FDEs use on
+ * 64 bit targets.
+ *
+ * @return false for an encoding it does not handle
+ */
+inline bool
+read_encoded(std::uint8_t p_encoding,
+             const std::uint8_t*& p_data,
+             std::uintptr_t& p_value)
+{
+  auto field = reinterpret_cast<std::uintptr_t>(p_data);
+  switch (p_encoding & 0x0F) {
+    case pe_absptr:
+      p_value = read<std::uintptr_t>(p_data);
+      break;
+    case pe_uleb128:
+      p_value = read_uleb128(p_data);
+      break;
+    case pe_udata2:
+      p_value = read<std::uint16_t>(p_data);
+      break;
+    case pe_udata4:
+      p_value = read<std::uint32_t>(p_data);
+      break;
+    case pe_udata8:
+      p_value = read<std::uint64_t>(p_data);
+      break;
+    case pe_sleb128:
+      p_value = read_sleb128(p_data);
+      break;
+    case pe_sdata2:
+      p_value = read<std::int16_t>(p_data);
+      break;
+    case pe_sdata4:
+      p_value = read<std::int32_t>(p_data);
+      break;
+    case pe_sdata8:
+      p_value = read<std::int64_t>(p_data);
+      break;
+    default:
+      return false;
+  }
+
+  switch (p_encoding & 0x70) {
+    case pe_absptr:
+      break;
+    case pe_pcrel:
+      p_value += field;
+      break;
+    default:
+      return false;
+  }
+  // Indirect pointers are not used by FDEs
+  return (p_encoding & 0x80) == 0;
+}
+
+/**
+ * @brief Pointer encoding of the FDEs of a CIE, its 'R' augmentation
+ *
+ * @return pe_omit for a CIE it does not handle
+ */
+inline std::uint8_t
+fde_encoding(const std::uint8_t* p_cie)
+{
+  const std::uint8_t* data = p_cie;
+  if (read<std::uint32_t>(data) == 0xFFFF'FFFF) {
+    // 64 bit DWARF
+    return pe_omit;
+  }
+  data += sizeof(std::uint32_t);  // CIE id
+  auto version = *data++;
+  auto* augmentation = reinterpret_cast<const char*>(data);
+  data += std::strlen(augmentation) + 1;
+  if (augmentation[0] != 'z') {
+    return augmentation[0] == '\0' ? pe_absptr : pe_omit;
+  }
+
+  read_uleb128(data);  // code alignment
+  read_sleb128(data);  // data alignment
+  if (version == 1) {
+    data++;
+  } else {
+    read_uleb128(data);
+  }
+  read_uleb128(data);  // augmentation length
+
+  for (auto* letter = augmentation + 1; *letter != '\0'; letter++) {
+    switch (*letter) {
+      case 'R':
+        return *data;
+      case 'L':
+        data++;
+        break;
+      case 'P': {
+        auto encoding = *data++;
+        std::uintptr_t personality = 0;
+        // The personality is often indirect, only its size matters here
+        if (!read_encoded(encoding & 0x7F, data, personality)) {
+          return pe_omit;
+        }
+        break;
+      }
+      case 'S':
+      case 'B':
+        break;
+      default:
+        return pe_omit;
+    }
+  }
+  return pe_absptr;
+}
+
+/// .eh_frame_hdr search table of one loaded object
+struct search_table
+{
+  /// Lowest and one past the highest address of its executable segments
+  std::uintptr_t begin = UINTPTR_MAX;
+  std::uintptr_t end = 0;
+  /// Base of the datarel entries, the start of .eh_frame_hdr
+  std::uintptr_t header = 0;
+  /// Pairs of initial location and FDE address, sorted by location
+  const std::int32_t* entries = nullptr;
+  std::size_t count = 0;
+};
+
+struct snapshot
+{
+  /// Sorted by begin
+  std::vector<search_table> tables;
+};
+
+inline std::atomic<const snapshot*> current{ nullptr };
+/// Takes the first snapshot, threads that throw before it is out wait on it
+inline std::once_flag first_snapshot;
+
+inline int
+add_object(dl_phdr_info* p_info, std::size_t, void* p_snapshot)
+{
+  search_table table{};
+  const std::uint8_t* header = nullptr;
+  for (std::size_t index = 0; index < p_info->dlpi_phnum; index++) {
+    auto& segment = p_info->dlpi_phdr[index];
+    auto address = p_info->dlpi_addr + segment.p_vaddr;
+    if (segment.p_type == PT_LOAD && (segment.p_flags & PF_X)) {
+      table.begin = std::min<std::uintptr_t>(table.begin, address);
+      table.end =
+        std::max<std::uintptr_t>(table.end, address + segment.p_memsz);
+    } else if (segment.p_type == PT_GNU_EH_FRAME) {
+      header = reinterpret_cast<const std::uint8_t*>(address);
+    }
+  }
+
+  // version, eh_frame_ptr encoding, fde_count encoding, table encoding
+  if (header == nullptr || header[0] != 1 || header[3] != table_encoding) {
+    return 0;
+  }
+  const std::uint8_t* data = header + 4;
+  std::uintptr_t eh_frame = 0;
+  std::uintptr_t count = 0;
+  if (!read_encoded(header[1], data, eh_frame) ||
+      !read_encoded(header[2], data, count) || count == 0) {
+    return 0;
+  }
+
+  table.header = reinterpret_cast<std::uintptr_t>(header);
+  table.entries = reinterpret_cast<const std::int32_t*>(data);
+  table.count = count;
+  static_cast<snapshot*>(p_snapshot)->tables.push_back(table);
+  return 0;
+}
+}  // namespace fde_detail
+
+/// Lookups the snapshot could not answer, they went to libgcc
+inline std::atomic<std::uint32_t> fde_cache_misses = 0;
+
+/**
+ * @brief Takes a new snapshot of the loaded objects and publishes it
+ *
+ * Safe to call while other threads search, the snapshot they hold stays
+ * valid.
+ */
+inline const fde_detail::snapshot*
+fde_cache_refresh()
+{
+  auto* snapshot = new fde_detail::snapshot;
+  dl_iterate_phdr(fde_detail::add_object, snapshot);
+  std::sort(snapshot->tables.begin(),
+            snapshot->tables.end(),
+            [](const auto& p_left, const auto& p_right) {
+              return p_left.begin < p_right.begin;
+            });
+  fde_detail::current.store(snapshot, std::memory_order_release);
+  return snapshot;
+}
+
+/// Same contract as _Unwind_Find_FDE
+inline const void*
+fde_cache_find(void* p_pc, dwarf_eh_bases* p_bases)
+{
+  using namespace fde_detail;
+
+  auto* cache = current.load(std::memory_order_acquire);
+  if (cache == nullptr) {
+    // One thread walks the loaded objects under the loader lock, the others
+    // wait for its snapshot instead of taking the lock and leaking their own
+    std::call_once(first_snapshot, [] {
+      if (current.load(std::memory_order_acquire) == nullptr) {
+        fde_cache_refresh();
+      }
+    });
+    cache = current.load(std::memory_order_acquire);
+  }
+
+  auto pc = reinterpret_cast<std::uintptr_t>(p_pc);
+  auto& tables = cache->tables;
+  auto table = std::upper_bound(
+    tables.begin(), tables.end(), pc, [](auto p_pc, const auto& p_table) {
+      return p_pc < p_table.begin;
+    });
+
+  if (table != tables.begin() && pc < (--table)->end) {
+    // Last entry whose initial location is at or below pc
+    std::size_t low = 0;
+    std::size_t high = table->count;
+    while (low < high) {
+      auto middle = (low + high) / 2;
+      if (table->header + table->entries[2 * middle] <= pc) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+
+    if (low != 0) {
+      auto* fde = reinterpret_cast<const std::uint8_t*>(
+        table->header + table->entries[2 * (low - 1) + 1]);
+      const std::uint8_t* data = fde;
+      auto length = read<std::uint32_t>(data);
+      auto cie_offset = read<std::uint32_t>(data);
+      auto encoding = fde_encoding(data - sizeof(std::uint32_t) - cie_offset);
+
+      std::uintptr_t function = 0;
+      std::uintptr_t range = 0;
+      // A 64 bit DWARF FDE has a different layout
+      if (length != 0xFFFF'FFFF && encoding != pe_omit &&
+          read_encoded(encoding, data, function) &&
+          read_encoded(encoding & 0x0F, data, range) && function <= pc &&
+          pc < function + range) {
+        // tbase and dbase are only set on i386 and FR-V
+        p_bases->tbase = nullptr;
+        p_bases->dbase = nullptr;
+        p_bases->func = reinterpret_cast<void*>(function);
+        return fde;
+      }
+    }
+  }
+
+  fde_cache_misses.fetch_add(1, std::memory_order_relaxed);
+  return __real__Unwind_Find_FDE(p_pc, p_bases);
+}
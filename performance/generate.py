@@ -14,7 +14,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-from typing import List
+import argparse
+from typing import List, Optional
 from enum import Enum
 from pathlib import Path
 
@@ -25,123 +26,92 @@ _UNIVERSAL_START = """
     #include <cstdint>
     #include <cstdlib>
     #include <exception>
+    #include <optional>
     #include <span>
     #include <string_view>
 
+    #include "exception_allocator.hpp"
+    #include "exception_globals.hpp"
+    #include "platform.hpp"
+    #include "statistics.hpp"
+
     volatile std::int32_t side_effect = 0;
     std::uint32_t start_cycles = 0;
     std::uint32_t end_cycles = 0;
+    """
 
-    /// Structure type to access the Data Watch point and Trace Register (DWT).
-    struct dwt_register_t
-    {
-    /// Offset: 0x000 (R/W)  Control Register
-    volatile uint32_t ctrl;
-    /// Offset: 0x004 (R/W)  Cycle Count Register
-    volatile uint32_t cyccnt;
-    /// Offset: 0x008 (R/W)  CPI Count Register
-    volatile uint32_t cpicnt;
-    /// Offset: 0x00C (R/W)  Exception Overhead Count Register
-    volatile uint32_t exccnt;
-    /// Offset: 0x010 (R/W)  Sleep Count Register
-    volatile uint32_t sleepcnt;
-    /// Offset: 0x014 (R/W)  LSU Count Register
-    volatile uint32_t lsucnt;
-    /// Offset: 0x018 (R/W)  Folded-instruction Count Register
-    volatile uint32_t foldcnt;
-    /// Offset: 0x01C (R/ )  Program Counter Sample Register
-    volatile const uint32_t pcsr;
-    /// Offset: 0x020 (R/W)  Comparator Register 0
-    volatile uint32_t comp0;
-    /// Offset: 0x024 (R/W)  Mask Register 0
-    volatile uint32_t mask0;
-    /// Offset: 0x028 (R/W)  Function Register 0
-    volatile uint32_t function0;
-    /// Reserved 0
-    std::array<uint32_t, 1> reserved0;
-    /// Offset: 0x030 (R/W)  Comparator Register 1
-    volatile uint32_t comp1;
-    /// Offset: 0x034 (R/W)  Mask Register 1
-    volatile uint32_t mask1;
-    /// Offset: 0x038 (R/W)  Function Register 1
-    volatile uint32_t function1;
-    /// Reserved 1
-    std::array<uint32_t, 1> reserved1;
-    /// Offset: 0x040 (R/W)  Comparator Register 2
-    volatile uint32_t comp2;
-    /// Offset: 0x044 (R/W)  Mask Register 2
-    volatile uint32_t mask2;
-    /// Offset: 0x048 (R/W)  Function Register 2
-    volatile uint32_t function2;
-    /// Reserved 2
-    std::array<uint32_t, 1> reserved2;
-    /// Offset: 0x050 (R/W)  Comparator Register 3
-    volatile uint32_t comp3;
-    /// Offset: 0x054 (R/W)  Mask Register 3
-    volatile uint32_t mask3;
-    /// Offset: 0x058 (R/W)  Function Register 3
-    volatile uint32_t function3;
-    };
-
-    /// Structure type to access the Core Debug Register (CoreDebug)
-    struct core_debug_registers_t
-    {
-    /// Offset: 0x000 (R/W)  Debug Halting Control and Status Register
-    volatile uint32_t dhcsr;
-    /// Offset: 0x004 ( /W)  Debug Core Register Selector Register
-    volatile uint32_t dcrsr;
-    /// Offset: 0x008 (R/W)  Debug Core Register Data Register
-    volatile uint32_t dcrdr;
-    /// Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register
-    volatile uint32_t demcr;
-    };
-
-    /// Address of the hardware DWT registers
-    constexpr intptr_t dwt_address = 0xE0001000UL;
-
-    /// Address of the Cortex M CoreDebug module
-    constexpr intptr_t core_debug_address = 0xE000EDF0UL;
 
-    // NOLINTNEXTLINE
-    auto* dwt = reinterpret_cast<dwt_register_t*>(dwt_address);
+def error_data(values: List[int], error_size: int):
+    """Initializer of my_error_t::data, cut short for errors under 4 bytes"""
+    return ", ".join("0x{:02X}".format(value)
+                     for value in values[:error_size])
 
-    // NOLINTNEXTLINE
-    auto* core = reinterpret_cast<core_debug_registers_t*>(core_debug_address);
 
-    void
-    dwt_counter_enable()
-    {
-    /**
-    * @brief This bit must be set to 1 to enable use of the trace and debug
-    * blocks:
-    *
-    *   - Data Watchpoint and Trace (DWT)
-    *   - Instrumentation Trace Macrocell (ITM)
-    *   - Embedded Trace Macrocell (ETM)
-    *   - Trace Port Interface Unit (TPIU).
-    */
-    constexpr unsigned core_trace_enable = 1 << 24U;
-
-    /// Mask for turning on cycle counter.
-    constexpr unsigned enable_cycle_count = 1 << 0;
-
-    // Enable trace core
-    core->demcr = (core->demcr | core_trace_enable);
-
-    // Reset cycle count
-    dwt->cyccnt = 0;
-
-    // Start cycle count
-    dwt->ctrl = (dwt->ctrl | enable_cycle_count);
-    }
+class result_flavor:
+    """
+    How the result benchmark spells its result type. Every generate_result
+    takes one, result.cpp is written with `tl`, result_std.cpp with `std` and
+    result_packed.cpp with `packed`.
 
-    std::uint32_t
-    uptime()
-    {
-    return dwt->cyccnt;
-    }
+    packed_result.hpp only holds trivially copyable values, so the class
+    factories of the `packed` flavor still return tl::expected<class_N>. The
+    chain of funct_group functions and trigger() return in r0/r1.
     """
 
+    def __init__(self, name: str, header: str, expected: str,
+                 unexpected: str, received: str = "auto",
+                 value: str = "{value}", empty_value: str = "{{}}",
+                 factory: Optional["result_flavor"] = None):
+        self.name = name
+        self.header = header
+        self._expected = expected
+        self._unexpected = unexpected
+        self._received = received
+        self._value = value
+        self._empty_value = empty_value
+        self.factory = factory or self
+
+    def expected(self, value_type: str):
+        """Declared return type of a function returning `value_type`"""
+        return self._expected.format(type=value_type)
+
+    def received(self, value_type: str):
+        """Type of the variable that receives such a return value"""
+        return self._received.format(type=value_type)
+
+    def unexpected(self, error: str):
+        return self._unexpected.format(error=error)
+
+    def value(self, value: Optional[str] = None):
+        if value is None:
+            return self._empty_value.format()
+        return self._value.format(value=value)
+
+
+TL_EXPECTED = result_flavor(
+    name="tl",
+    header="#include <tl/expected.hpp>",
+    expected="tl::expected<{type}, my_error_t>",
+    unexpected="tl::unexpected({error})")
+
+RESULT_FLAVORS = {
+    "tl": TL_EXPECTED,
+    "std": result_flavor(
+        name="std",
+        header="#include <expected>",
+        expected="std::expected<{type}, my_error_t>",
+        unexpected="std::unexpected({error})"),
+    "packed": result_flavor(
+        name="packed",
+        header="#include <tl/expected.hpp>\n#include \"packed_result.hpp\"",
+        expected="packed_bits",
+        unexpected="packed_error({error})",
+        received="packed_result<{type}, my_error_t>",
+        value="packed_value({value})",
+        empty_value="packed_value()",
+        factory=TL_EXPECTED),
+}
+
 
 class gen_class:
     def __init__(self, id: int, nontrivial_dtor: bool = True):
@@ -156,18 +126,19 @@ class gen_class:
     def is_nontrivial(self):
         return self.nontrivial_dtor
 
-    def generate_except(self):
+    def generate_except(self, error_size: int = 4):
         start = "class class_{id} {{ public:".format(id=self._id)
         ctor = """
         class_{id}(std::int32_t p_channel)
             : m_channel(p_channel)
         {{
             if (m_channel >= 1'000'000'000) {{
-                throw my_error_t{{ .data = {{ 0x55, 0xAA, 0x33, 0x44 }} }};
+                throw my_error_t{{ .data = {{ {data} }} }};
             }}
             side_effect = side_effect + 1;
         }}
-        """.format(id=self._id)
+        """.format(id=self._id,
+                   data=error_data([0x55, 0xAA, 0x33, 0x44], error_size))
 
         copy_and_move_ctors = """
         class_{id}(class_{id}&) = delete;
@@ -187,13 +158,13 @@ class gen_class:
 
         class_function = """
         void trigger()
-        {
-            if (m_channel >= 1'000'000'000) {
-                throw my_error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
-            }
+        {{
+            if (m_channel >= 1'000'000'000) {{
+                throw my_error_t{{ .data = {{ {data} }} }};
+            }}
             side_effect = side_effect + 1;
-        }
-        """
+        }}
+        """.format(data=error_data([0xAA, 0xBB, 0x33, 0x44], error_size))
 
         footer = """
         private:
@@ -204,20 +175,25 @@ class gen_class:
         return start + ctor + copy_and_move_ctors + dtor + class_function + \
             footer
 
-    def generate_result(self):
+    def generate_result(self, error_size: int = 4,
+                        flavor: result_flavor = TL_EXPECTED):
         start = "class class_{id} {{ public:".format(id=self._id)
         factory = """
-        static tl::expected<class_{id}, my_error_t> make(std::int32_t p_channel)
+        static {expected} make(std::int32_t p_channel)
         {{
             if (p_channel >= 1'000'000'000) {{
-                return tl::unexpected(
-                    my_error_t{{ .data = {{ 0x55, 0xAA, 0x33, 0x44 }} }}
-                );
+                return {unexpected};
             }}
             side_effect = side_effect + 1;
             return class_{id}(p_channel);
         }}
-        """.format(id=self._id)
+        """.format(id=self._id,
+                   expected=flavor.factory.expected(
+                       "class_{id}".format(id=self._id)),
+                   unexpected=flavor.factory.unexpected(
+                       "my_error_t{{ .data = {{ {data} }} }}".format(
+                           data=error_data([0x55, 0xAA, 0x33, 0x44],
+                                           error_size))))
 
         copy_and_move_ctors = """
         class_{id}(class_{id}&) = delete;
@@ -236,18 +212,21 @@ class gen_class:
             dtor = "~class_{id}() = default;".format(id=self._id)
 
         class_function = """
-        tl::expected<void, my_error_t> trigger()
-        {
-            if (m_channel >= 1'000'000'000) {
-                return tl::unexpected(
-                    my_error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } }
-                );
-            }
+        {expected} trigger()
+        {{
+            if (m_channel >= 1'000'000'000) {{
+                return {unexpected};
+            }}
             side_effect = side_effect + 1;
 
-            return {};
-        }
-        """
+            return {value};
+        }}
+        """.format(expected=flavor.expected("void"),
+                   unexpected=flavor.unexpected(
+                       "my_error_t{{ .data = {{ {data} }} }}".format(
+                           data=error_data([0xAA, 0xBB, 0x33, 0x44],
+                                           error_size))),
+                   value=flavor.value())
 
         ctor = """
         private:
@@ -265,6 +244,48 @@ class gen_class:
         return start + factory + copy_and_move_ctors + dtor + class_function + \
             ctor + footer
 
+    def generate_baseline(self):
+        start = "class class_{id} {{ public:".format(id=self._id)
+        ctor = """
+        class_{id}(std::int32_t p_channel)
+            : m_channel(p_channel)
+        {{
+            side_effect = side_effect + 1;
+        }}
+        """.format(id=self._id)
+
+        copy_and_move_ctors = """
+        class_{id}(class_{id}&) = delete;
+        class_{id}& operator=(class_{id}&) = delete;
+        class_{id}(class_{id}&&) noexcept = default;
+        class_{id}& operator=(class_{id}&&) noexcept = default;
+        """.format(id=self._id)
+
+        if self.nontrivial_dtor:
+            dtor = """~class_{id}()
+            {{
+                side_effect = side_effect & ~(1 << m_channel);
+            }}
+            """.format(id=self._id)
+        else:
+            dtor = "~class_{id}() = default;".format(id=self._id)
+
+        class_function = """
+        void trigger()
+        {
+            side_effect = side_effect + 1;
+        }
+        """
+
+        footer = """
+        private:
+            std::int32_t m_channel = 0;
+        }};
+        """.format(id=self._id)
+
+        return start + ctor + copy_and_move_ctors + dtor + class_function + \
+            footer
+
 
 class gen_class_usage:
     def __init__(self, p_class: gen_class, p_trigger_count: int):
@@ -282,27 +303,40 @@ class gen_class_usage:
             'instance_{instance}.trigger();\n'.format(instance=p_instance) \
             * self.m_trigger_count
 
-    def generate_result(self, p_instance: int):
+    def generate_result(self, p_instance: int,
+                        flavor: result_flavor = TL_EXPECTED):
         create = """
         auto instance_{instance} = class_{id}::make(side_effect);
         if (!instance_{instance}) {{
-            return tl::unexpected(instance_{instance}.error());
+            return {unexpected};
         }}
         """.format(
             id=self.m_class.id,
-            instance=p_instance)
+            instance=p_instance,
+            unexpected=flavor.unexpected(
+                "instance_{instance}.error()".format(instance=p_instance)))
 
         # NOTE: I scoped this so I wouldn't have to come up with random variable
         # names for each result object
         call = """{{
-        auto scoped_result = instance_{instance}.value().trigger();
+        {received} scoped_result = instance_{instance}.value().trigger();
         if (!scoped_result) {{
-            return tl::unexpected(scoped_result.error());
+            return {unexpected};
         }}
-        }}""".format(instance=p_instance) * self.m_trigger_count
+        }}""".format(instance=p_instance,
+                     received=flavor.received("void"),
+                     unexpected=flavor.unexpected("scoped_result.error()")) \
+            * self.m_trigger_count
 
         return create + call
 
+    def generate_baseline(self, p_instance: int):
+        return 'class_{id} instance_{instance}(side_effect);\n'.format(
+            id=self.m_class.id,
+            instance=p_instance) + \
+            'instance_{instance}.trigger();\n'.format(instance=p_instance) \
+            * self.m_trigger_count
+
 
 class call_position(Enum):
     TOP = 1
@@ -310,22 +344,67 @@ class call_position(Enum):
     BOTTOM = 3
 
 
+class call_handler(Enum):
+    """
+    try block around the call to the next function of the chain. Only
+    generate_except emits it, the result and baseline chains have nothing to
+    catch.
+    """
+    NONE = 1
+    # Catches my_error_t, the throw ends in this frame
+    CATCH = 2
+    # Catches my_error_t and rethrows it with `throw;`
+    RETHROW = 3
+    # Catches other_error_t, so the personality routine checks the handler
+    # and the throw goes on
+    PASS = 4
+
+
 class gen_function:
     def __init__(self,
                  usages: List[gen_class_usage],
-                 position: call_position):
+                 position: call_position,
+                 handler: call_handler = call_handler.NONE):
         self.usages = usages
         self.position = position
+        self.handler = handler
+
+    def except_handler(self, call: str):
+        """Wraps `call` in the try block of self.handler"""
+        if self.handler == call_handler.NONE:
+            return call
+
+        if self.handler == call_handler.CATCH:
+            caught, body = "my_error_t", "end_cycles = uptime();"
+        elif self.handler == call_handler.RETHROW:
+            caught, body = "my_error_t", """
+                inner_side_effect = inner_side_effect + 1;
+                throw;"""
+        else:
+            caught, body = "other_error_t", """
+                inner_side_effect = inner_side_effect + 1;"""
+
+        return """
+            try {{
+                {call}
+            }} catch ([[maybe_unused]] const {caught}& p_error) {{
+                {body}
+            }}
+            """.format(call=call, caught=caught, body=body)
 
     def generate_except(self,
                         instance: int,
                         group_id: int,
-                        is_terminal: bool = False):
+                        is_terminal: bool = False,
+                        error_size: int = 4):
         section_marker = ""
 
         for usage in self.usages:
             if not usage.is_nontrivial:
                 section_marker = '[[gnu::section(".trivial_handle")]]'
+        if self.handler != call_handler.NONE:
+            # The handler needs the function's unwind entry
+            section_marker = ""
 
         start = """
         {section_marker} int funct_group{group}_{id}()
@@ -337,17 +416,17 @@ class gen_function:
         if is_terminal:
             next_function_call = """
                 if (side_effect > 0)
-                {
+                {{
                     start_cycles = uptime();
-                    throw my_error_t{ .data = { 0xDE, 0xAD } };
-                }
-                """
+                    throw my_error_t{{ .data = {{ {data} }} }};
+                }}
+                """.format(data=error_data([0xDE, 0xAD], error_size))
         else:
             start = 'int funct_group{group}_{id}(); \n'.format(
                 group=group_id, id=instance + 1) + start
-            next_function_call = \
+            next_function_call = self.except_handler(
                 "side_effect = side_effect + funct_group{group}_{id}();".format(
-                    group=group_id, id=instance + 1)
+                    group=group_id, id=instance + 1))
 
         if self.position == call_position.TOP:
             start = start + next_function_call
@@ -372,33 +451,82 @@ class gen_function:
     def generate_result(self,
                         instance: int,
                         group_id: int,
-                        is_terminal: bool = False):
+                        is_terminal: bool = False,
+                        error_size: int = 4,
+                        flavor: result_flavor = TL_EXPECTED):
         start = """
-        tl::expected<int, my_error_t> funct_group{group}_{id}()
+        {expected} funct_group{group}_{id}()
         {{
             volatile static std::uint32_t inner_side_effect = 0;
             inner_side_effect = inner_side_effect + 1;
-        """.format(id=instance, group=group_id)
+        """.format(id=instance, group=group_id,
+                   expected=flavor.expected("int"))
 
         if is_terminal:
             next_function_call = """
                 if (side_effect > 0)
-                {
-                    return tl::unexpected(my_error_t{ .data = { 0xDE, 0xAD } });
-                }
-                """
+                {{
+                    return {unexpected};
+                }}
+                """.format(unexpected=flavor.unexpected(
+                    "my_error_t{{ .data = {{ {data} }} }}".format(
+                        data=error_data([0xDE, 0xAD], error_size))))
         else:
             start = """
-            tl::expected<int, my_error_t> funct_group{group}_{id}(); \n
+            {expected} funct_group{group}_{id}(); \n
             """.format(
-                group=group_id, id=instance + 1) + start
+                group=group_id, id=instance + 1,
+                expected=flavor.expected("int")) + start
             next_function_call = """
-                if(auto result = funct_group{group}_{id}(); !result) {{
-                    return tl::unexpected(result.error());
+                if({received} result = funct_group{group}_{id}(); !result) {{
+                    return {unexpected};
                 }} else {{
                     side_effect = side_effect + result.value();
                 }}""".format(
-                group=group_id, id=instance + 1)
+                group=group_id, id=instance + 1,
+                received=flavor.received("int"),
+                unexpected=flavor.unexpected("result.error()"))
+
+        if self.position == call_position.TOP:
+            start = start + next_function_call
+
+        body = []
+        for index, usages in enumerate(self.usages):
+            if (self.position == call_position.MIDDLE and
+                    index == round(len(self.usages) / 2)):
+                body.append(next_function_call)
+            body.append(usages.generate_result(index, flavor))
+
+        footer = """
+        return {value};
+        }}
+        """.format(value=flavor.value("side_effect"))
+
+        if self.position == call_position.BOTTOM:
+            footer = next_function_call + footer
+
+        return start + "\n".join(body) + footer
+
+    def generate_baseline(self,
+                          instance: int,
+                          group_id: int,
+                          is_terminal: bool = False):
+        start = """
+        int funct_group{group}_{id}()
+        {{
+            volatile static std::uint32_t inner_side_effect = 0;
+            inner_side_effect = inner_side_effect + 1;
+        """.format(id=instance, group=group_id)
+
+        if is_terminal:
+            # Nothing to detect or report, the chain just ends
+            next_function_call = ""
+        else:
+            start = 'int funct_group{group}_{id}(); \n'.format(
+                group=group_id, id=instance + 1) + start
+            next_function_call = \
+                "side_effect = side_effect + funct_group{group}_{id}();".format(
+                    group=group_id, id=instance + 1)
 
         if self.position == call_position.TOP:
             start = start + next_function_call
@@ -408,7 +536,7 @@ class gen_function:
             if (self.position == call_position.MIDDLE and
                     index == round(len(self.usages) / 2)):
                 body.append(next_function_call)
-            body.append(usages.generate_result(index))
+            body.append(usages.generate_baseline(index))
 
         footer = """
         return side_effect;
@@ -446,47 +574,249 @@ class gen_function_group:
     def except_call_function_signature(self, group_id: int):
         return "funct_group{group}_0".format(group=group_id)
 
-    def result_forward_declare_start(self, group_id: int):
-        return "tl::expected<int, my_error_t> funct_group{group}_0();".format(group=group_id)
+    def result_forward_declare_start(self, group_id: int,
+                                     flavor: result_flavor = TL_EXPECTED):
+        return "{expected} funct_group{group}_0();".format(
+            group=group_id, expected=flavor.expected("int"))
 
-    def result_call_start(self, group_id: int):
+    def result_call_start(self, group_id: int,
+                          flavor: result_flavor = TL_EXPECTED):
         return """
-        if (auto result = funct_group{group}_0(); !result) {{
-            return tl::unexpected(result.error());
+        if ({received} result = funct_group{group}_0(); !result) {{
+            return {unexpected};
         }}
-        """.format(group=group_id)
+        """.format(group=group_id, received=flavor.received("int"),
+                   unexpected=flavor.unexpected("result.error()"))
 
-    def result_call_start_with_time_check(self, group_id: int):
+    def result_call_start_with_time_check(self, group_id: int,
+                                          flavor: result_flavor = TL_EXPECTED):
         return """
         start_cycles = uptime();
-        if (auto result = funct_group{group}_0(); !result) {{
+        if ({received} result = funct_group{group}_0(); !result) {{
             end_cycles = uptime();
             cycle_map[{group}] = end_cycles - start_cycles;
         }}
-        """.format(group=group_id)
+        """.format(group=group_id, received=flavor.received("int"))
 
-    def generate_except(self, group_id: int):
+    def generate_except(self, group_id: int, error_size: int = 4):
         list = []
         for index, funct in enumerate(self.functions):
             list.append(funct.generate_except(index, group_id,
-                        index == len(self.functions) - 1))
+                        index == len(self.functions) - 1, error_size))
         return '\n'.join(list)
 
-    def generate_result(self, group_id: int):
+    def generate_result(self, group_id: int, error_size: int = 4,
+                        flavor: result_flavor = TL_EXPECTED):
         list = []
         for index, funct in enumerate(self.functions):
             list.append(funct.generate_result(index, group_id,
+                        index == len(self.functions) - 1, error_size,
+                        flavor))
+        return '\n'.join(list)
+
+    def generate_baseline(self, group_id: int):
+        list = []
+        for index, funct in enumerate(self.functions):
+            list.append(funct.generate_baseline(index, group_id,
                         index == len(self.functions) - 1))
         return '\n'.join(list)
 
 
+class gen_error_hierarchy:
+    """
+    Error types for one row of the hierarchy benchmark. `depth` classes
+    derive from the root `error{id}_0`, one after the other, and the most
+    derived one is thrown. With more than one base per level the chain to the
+    root is the last base, after `bases - 1` empty tags, so the type match
+    walks every tag before it finds the root. A polymorphic root is an
+    interface like hal::io_error.
+    """
+
+    def __init__(self, id: int, depth: int, bases: int, polymorphic: bool):
+        self.id = id
+        self.depth = depth
+        self.bases = bases
+        self.polymorphic = polymorphic
+
+    @property
+    def root(self):
+        return "error{id}_0".format(id=self.id)
+
+    @property
+    def thrown(self):
+        return "error{id}_{depth}".format(id=self.id, depth=self.depth)
+
+    def generate(self):
+        if self.polymorphic:
+            interface = """
+            virtual ~error{id}_0() = default;
+            virtual int code() const {{ return data[0]; }}
+            """.format(id=self.id)
+        else:
+            interface = ""
+
+        source = ["""
+        struct error{id}_0
+        {{
+            {interface}
+            std::array<std::uint8_t, 4> data{{ 0xDE, 0xAD, 0x33, 0x44 }};
+        }};
+        """.format(id=self.id, interface=interface)]
+
+        for level in range(1, self.depth + 1):
+            bases = []
+            for tag in range(self.bases - 1):
+                source.append("struct error{id}_{level}_tag{tag} {{}};".format(
+                    id=self.id, level=level, tag=tag))
+                bases.append("public error{id}_{level}_tag{tag}".format(
+                    id=self.id, level=level, tag=tag))
+            bases.append("public error{id}_{parent}".format(
+                id=self.id, parent=level - 1))
+            source.append("struct error{id}_{level} : {bases} {{}};".format(
+                id=self.id, level=level, bases=", ".join(bases)))
+
+        return "\n".join(source)
+
+    def generate_functions(self, call_depth: int):
+        """
+        Call chain of call_depth functions that throws the most derived type,
+        a catcher that catches it by its root and returns the cycles of the
+        throw, and a function that times the type match alone.
+        """
+        source = []
+        for index in range(call_depth - 1):
+            source.append("""
+            int hierarchy{id}_{next}();
+            int hierarchy{id}_{index}()
+            {{
+                volatile static std::uint32_t inner_side_effect = 0;
+                inner_side_effect = inner_side_effect + 1;
+                side_effect = side_effect + hierarchy{id}_{next}();
+                return side_effect;
+            }}
+            """.format(id=self.id, index=index, next=index + 1))
+
+        source.append("""
+        int hierarchy{id}_{index}()
+        {{
+            volatile static std::uint32_t inner_side_effect = 0;
+            inner_side_effect = inner_side_effect + 1;
+            if (side_effect > 0)
+            {{
+                start_cycles = uptime();
+                throw {thrown}{{}};
+            }}
+            return side_effect;
+        }}
+
+        std::uint32_t catch_hierarchy{id}()
+        {{
+            try {{
+                side_effect = 1;
+                hierarchy{id}_0();
+            }} catch ([[maybe_unused]] const {root}& p_error) {{
+                end_cycles = uptime();
+                return elapsed_cycles(start_cycles, end_cycles);
+            }}
+            return 0;
+        }}
+
+        // The type_info of both types, found without typeid so this also
+        // builds with -fno-rtti
+        void find_types_hierarchy{id}(const std::type_info*& p_thrown,
+                                      const std::type_info*& p_caught)
+        {{
+            try {{
+                throw {thrown}{{}};
+            }} catch (...) {{
+                p_thrown = abi::__cxa_current_exception_type();
+            }}
+            try {{
+                throw {root}{{}};
+            }} catch (...) {{
+                p_caught = abi::__cxa_current_exception_type();
+            }}
+        }}
+
+        // What the personality routine calls to match the handler, once per
+        // throw
+        std::uint32_t match_hierarchy{id}()
+        {{
+            static const std::type_info* thrown = nullptr;
+            static const std::type_info* caught = nullptr;
+            if (thrown == nullptr) {{
+                find_types_hierarchy{id}(thrown, caught);
+            }}
+            {thrown} object{{}};
+            void* adjusted = &object;
+            start_cycles = uptime();
+            bool matched = caught->__do_catch(thrown, &adjusted, 1);
+            end_cycles = uptime();
+            side_effect = side_effect + matched;
+            return elapsed_cycles(start_cycles, end_cycles);
+        }}
+        """.format(id=self.id, index=call_depth - 1, thrown=self.thrown,
+                   root=self.root))
+        return "\n".join(source)
+
+
+def schedule_loop(schedule: str, errors: str, measure: str,
+                  functions: str = "functions"):
+    """
+    Loop that measures every group trial_count times. `measure` is the body
+    that runs group `index` through `funct`, taken from the array
+    `functions`, and stores the result into trial_cycles[index][trial].
+    """
+    if schedule == "repeated":
+        return """
+            // Each group back to back trial_count times, like the same
+            // error out of a retry loop, so anything cached while handling
+            // the first one helps the rest.
+            for (std::uint32_t index = 0; index < {functions}.size(); index++) {{
+                auto* funct = {functions}[index];
+                for (std::size_t trial = 0; trial < trial_count; trial++) {{
+                    {measure}
+                }}
+            }}
+        """.format(measure=measure, functions=functions)
+
+    return """
+            // Round robin over the groups so every trial sees the same
+            // sequence of {errors} as a single pass would.
+            for (std::size_t trial = 0; trial < trial_count; trial++) {{
+                std::uint32_t index = 0;
+                for (auto& funct : {functions}) {{
+                    {measure}
+                    index++;
+                }}
+            }}
+        """.format(errors=errors, measure=measure, functions=functions)
+
+
+def happy_path_loop(schedule: str, measure: str):
+    """
+    Loop that times every group trial_count times without an error. A
+    negative side_effect keeps every terminal function and class away from
+    its error branch. `measure` stores into trial_cycles[index][trial], which
+    is free again once cycle_stats holds the error trials.
+    """
+    return """
+            {loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                happy_cycle_map[index] = summarize(trial_cycles[index]).median;
+            }}
+        """.format(loop=schedule_loop(schedule, "calls", """
+            side_effect = -1'000'000'000;
+        """ + measure))
+
+
 class gen_exception_performance_application:
     _EXCEPTION_START = """
+    #include "eit_cache.hpp"
+
     [[noreturn]] void terminate() noexcept
     {
-    while (true) {
-        continue;
-    }
+    benchmark_halt();
     }
 
     namespace __cxxabiv1 {  // NOLINT
@@ -497,9 +827,7 @@ class gen_exception_performance_application:
     {
     void _exit([[maybe_unused]] int rc)
     {
-        while (true) {
-        continue;
-        }
+        benchmark_halt();
     }
     int kill(int, int)
     {
@@ -511,29 +839,32 @@ class gen_exception_performance_application:
         return 1;
     }
 
-    std::array<std::uint8_t, 1024> storage;
-    std::span<std::uint8_t> storage_left(storage);
+    exception_allocator<EXCEPTION_POOL_SIZE> exception_pool;
     void* __wrap___cxa_allocate_exception(unsigned int p_size)  // NOLINT
     {
-        // I only know this needs to be 128 because of the disassembly. I cannot
-        // figure out why its needed yet, but maybe the answer is in the
-        // libunwind-arm.cpp file.
-        static constexpr size_t offset = 128;
-        if (p_size + offset > storage_left.size()) {
-        return nullptr;
+        auto* memory = exception_pool.allocate(p_size);
+        if (memory == nullptr) {
+            // Same as libsupc++ once its emergency pool is exhausted
+            std::terminate();
         }
-        auto* memory = &storage_left[offset];
-        storage_left = storage_left.subspan(p_size + offset);
         return memory;
     }
-    void __wrap___cxa_free_exception(void*)  // NOLINT
+    void __wrap___cxa_free_exception(void* p_thrown_object)  // NOLINT
     {
-        storage_left = std::span<std::uint8_t>(storage);
+        exception_pool.free(p_thrown_object);
     }
     void __wrap___cxa_call_unexpected(void*) // NOLINT
     {
         std::terminate();
     }
+    void* __wrap___cxa_get_globals()  // NOLINT
+    {
+        return exception_globals_hook();
+    }
+    void* __wrap___cxa_get_globals_fast()  // NOLINT
+    {
+        return exception_globals_hook();
+    }
 
     using _uw = std::uint32_t;
 
@@ -560,10 +891,9 @@ class gen_exception_performance_application:
     extern std::uint32_t __trivial_handle_start;
     extern std::uint32_t __trivial_handle_end;
 
-    // NOLINTNEXTLINE
-    const void* search_EIT_table(const __EIT_entry* table,
-                                int nrec, // NOLINT
-                                _uw return_address)
+    static const void* lookup_EIT_table(const __EIT_entry* table,
+                                        int nrec, // NOLINT
+                                        _uw return_address)
     {
         _uw next_fn;
         _uw this_fn;
@@ -602,12 +932,30 @@ class gen_exception_performance_application:
             left = n + 1;
         }
     }
+
+    // Same return address cache as except_experimental.cpp, see
+    // eit_cache.hpp
+    eit_cache<EIT_CACHE_SIZE, EIT_CACHE_WAYS> eit_lookup_cache;
+
+    // NOLINTNEXTLINE
+    const void* search_EIT_table(const __EIT_entry* table,
+                                int nrec, // NOLINT
+                                _uw return_address)
+    {
+        const void* entry = eit_lookup_cache.find(return_address);
+        if (entry == nullptr) {
+            entry = lookup_EIT_table(table, nrec, return_address);
+            eit_lookup_cache.insert(return_address, entry);
+        }
+        return entry;
+    }
     }
     int start();
 
     int main()
     {
         dwt_counter_enable();
+        enable_flash_accelerator();
         volatile int return_code = 0;
         try {
             return_code = start();
@@ -619,13 +967,30 @@ class gen_exception_performance_application:
     }
     """
 
+    # Lookups of every throw that eit_lookup_cache answered or missed, summed
+    # per group over the error trials
+    _CACHE_COUNT_BEFORE = """
+            std::uint32_t hits_before = eit_lookup_cache.hits;
+            std::uint32_t misses_before = eit_lookup_cache.misses;
+    """
+    _CACHE_COUNT_AFTER = """
+            cache_hit_map[index] = cache_hit_map[index].value_or(0) +
+                                   (eit_lookup_cache.hits - hits_before);
+            cache_miss_map[index] = cache_miss_map[index].value_or(0) +
+                                    (eit_lookup_cache.misses - misses_before);
+    """
+
     def __init__(self,
                  error_type_size: int,
                  groups: List[gen_function_group],
-                 classes: List[gen_class]):
+                 classes: List[gen_class],
+                 trial_count: int = 1,
+                 schedule: str = "round_robin"):
         self.error_type_size = error_type_size
         self.groups = groups
         self.classes = classes
+        self.trial_count = trial_count
+        self.schedule = schedule
 
     def create_start(self):
         start_template = """
@@ -638,16 +1003,27 @@ class gen_exception_performance_application:
         }};
         int start() {{
             cycle_map.fill(0);
-            std::uint32_t index = 0;
-            for (auto& funct : functions) {{
+            measure_call_latency();
+            {measure_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                cycle_stats[index] = summarize(trial_cycles[index]);
+                cycle_map[index] = cycle_stats[index].median;
+            }}
+            // Deepest stack each throw and catch reaches, unwinder included
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                stack_paint();
+                auto stack_reference = stack_pointer();
                 try {{
-                    start_cycles = uptime();
-                    funct();
+                    functions[index]();
                 }} catch ([[maybe_unused]] const my_error_t& p_error) {{
-                    end_cycles = uptime();
-                    cycle_map[index++] = end_cycles - start_cycles;
                 }}
+                stack_map[index] = {{ stack_usage(stack_reference) }};
             }}
+            {happy_loop}
+            export_csv("group_index,cycles,stack_bytes,happy_cycles,min,"
+                       "median,mean,max,p99,cache_hits,cache_misses",
+                       cycle_map, stack_map, happy_cycle_map, cycle_stats,
+                       cache_hit_map, cache_miss_map);
             return side_effect;
         }}
         """
@@ -659,10 +1035,32 @@ class gen_exception_performance_application:
             forwards.append(group.except_forward_declare_start(index))
             calls.append(group.except_call_function_signature(index))
 
-        return start_template.format(forward_declarations="\n".join(forwards),
-                                     body="\n".join(calls),
-                                     function_count=len(calls),
-                                     function_list=",".join(calls))
+        measure = self._CACHE_COUNT_BEFORE + """
+            try {
+                start_cycles = uptime();
+                funct();
+            } catch ([[maybe_unused]] const my_error_t& p_error) {
+                end_cycles = uptime();
+                trial_cycles[index][trial] =
+                    elapsed_cycles(start_cycles, end_cycles);
+            }
+        """ + self._CACHE_COUNT_AFTER
+
+        happy_measure = """
+            start_cycles = uptime();
+            funct();
+            end_cycles = uptime();
+            trial_cycles[index][trial] =
+                elapsed_cycles(start_cycles, end_cycles);
+        """
+
+        return start_template.format(
+            forward_declarations="\n".join(forwards),
+            body="\n".join(calls),
+            function_count=len(calls),
+            function_list=",".join(calls),
+            measure_loop=schedule_loop(self.schedule, "throws", measure),
+            happy_loop=happy_path_loop(self.schedule, happy_measure))
 
     def generate(self):
         global _UNIVERSAL_START
@@ -673,100 +1071,958 @@ class gen_exception_performance_application:
         }};
         """.format(size=self.error_type_size)
         cycle_map = """
+        constexpr std::size_t trial_count = {trials};
         std::array<std::uint64_t, {groups}> cycle_map{{}};
-        """.format(groups=len(self.groups))
+        std::array<cycle_statistics, {groups}> cycle_stats{{}};
+        std::array<std::array<std::uint32_t, trial_count>, {groups}>
+            trial_cycles{{}};
+        std::array<stack_depth, {groups}> stack_map{{}};
+        std::array<std::uint64_t, {groups}> happy_cycle_map{{}};
+        std::array<std::optional<std::uint64_t>, {groups}> cache_hit_map{{}};
+        std::array<std::optional<std::uint64_t>, {groups}> cache_miss_map{{}};
+        """.format(groups=len(self.groups), trials=self.trial_count)
         source = [_UNIVERSAL_START, error_type,
                   self._EXCEPTION_START, cycle_map]
 
         source.append(self.create_start())
 
         for classes in self.classes:
-            source.append(classes.generate_except())
+            source.append(classes.generate_except(self.error_type_size))
 
         for index, function_group in enumerate(self.groups):
-            source.append(function_group.generate_except(index))
+            source.append(function_group.generate_except(
+                index, self.error_type_size))
 
         return "\n".join(source)
 
 
-class gen_result_performance_application:
+class gen_host_exception_performance_application(
+        gen_exception_performance_application):
+    """
+    Same benchmark as gen_exception_performance_application but for a hosted
+    (Linux) target. None of the bare metal shims or the custom EIT search are
+    emitted, so throws go through the system's Itanium ABI runtime and
+    unwinder. Timing comes from platform.hpp (rdtsc or clock_gettime). With
+    no EIT cache, cache_hits and cache_misses are left empty.
+    """
+    _CACHE_COUNT_BEFORE = ""
+    _CACHE_COUNT_AFTER = ""
     _EXCEPTION_START = """
-    [[noreturn]] void
-    halt()
+    int start();
+
+    int main()
     {
-        while (true) {
-            continue;
+        dwt_counter_enable();
+        volatile int return_code = 0;
+        try {
+            return_code = start();
+        } catch (...) {
+            return_code = -1;
         }
+        return return_code;
     }
-    tl::expected<int, my_error_t> start();
+    """
+
+
+class gen_result_performance_application:
+    _EXCEPTION_START = """
+    {expected} start();
     int main()
-    {
+    {{
         dwt_counter_enable();
+        enable_flash_accelerator();
         volatile int return_code = 0;
-        auto result = start();
-        if (!result) {
+        {received} result = start();
+        if (!result) {{
             return_code = result.error().data[0];
-        } else {
+        }} else {{
             return_code = result.value();
-        }
-        halt();
+        }}
+        benchmark_halt();
         return return_code;
-    }
+    }}
     """
 
     def __init__(self,
                  error_type_size: int,
                  groups: List[gen_function_group],
-                 classes: List[gen_class]):
+                 classes: List[gen_class],
+                 trial_count: int = 1,
+                 schedule: str = "round_robin",
+                 flavor: result_flavor = TL_EXPECTED):
         self.error_type_size = error_type_size
         self.groups = groups
         self.classes = classes
+        self.trial_count = trial_count
+        self.schedule = schedule
+        self.flavor = flavor
 
     def create_start(self):
         start_template = """
         {forward_declarations}
-        tl::expected<int, my_error_t> start() {{
-            {body}
-            return side_effect;
+
+        using signature = {expected}(void);
+
+        std::array<signature*, {function_count}> functions = {{
+            {function_list}
+        }};
+        {expected} start() {{
+            cycle_map.fill(0);
+            measure_call_latency();
+            {measure_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                cycle_stats[index] = summarize(trial_cycles[index]);
+                cycle_map[index] = cycle_stats[index].median;
+            }}
+            // Deepest stack each error propagation reaches
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                stack_paint();
+                auto stack_reference = stack_pointer();
+                if ({received} result = functions[index](); !result) {{
+                    side_effect = side_effect + result.error().data[0];
+                }}
+                stack_map[index] = {{ stack_usage(stack_reference) }};
+            }}
+            {happy_loop}
+            export_csv("group_index,cycles,stack_bytes,happy_cycles,min,"
+                       "median,mean,max,p99",
+                       cycle_map, stack_map, happy_cycle_map, cycle_stats);
+            return {value};
         }}
         """
 
         forwards = []
         calls = []
 
+        flavor = self.flavor
         for index, group in enumerate(self.groups):
-            forwards.append(group.result_forward_declare_start(index))
-            calls.append(group.result_call_start_with_time_check(index))
+            forwards.append(group.result_forward_declare_start(index, flavor))
+            calls.append(group.except_call_function_signature(index))
 
-        return start_template.format(forward_declarations="\n".join(forwards),
-                                     body="\n".join(calls))
+        measure = """
+            start_cycles = uptime();
+            if ({received} result = funct(); !result) {{
+                end_cycles = uptime();
+                trial_cycles[index][trial] =
+                    elapsed_cycles(start_cycles, end_cycles);
+            }}
+        """.format(received=flavor.received("int"))
+
+        happy_measure = """
+            start_cycles = uptime();
+            if ({received} result = funct(); result) {{
+                end_cycles = uptime();
+                trial_cycles[index][trial] =
+                    elapsed_cycles(start_cycles, end_cycles);
+            }}
+        """.format(received=flavor.received("int"))
+
+        return start_template.format(
+            expected=flavor.expected("int"),
+            received=flavor.received("int"),
+            value=flavor.value("side_effect"),
+            forward_declarations="\n".join(forwards),
+            function_count=len(calls),
+            function_list=",".join(calls),
+            measure_loop=schedule_loop(self.schedule, "errors", measure),
+            happy_loop=happy_path_loop(self.schedule, happy_measure))
 
     def generate(self):
         global _UNIVERSAL_START
         error_type = """
-        #include <tl/expected.hpp>
+        {header}
         struct my_error_t
         {{
             std::array<std::uint8_t, {size}> data;
         }};
-        """.format(size=self.error_type_size)
+        """.format(header=self.flavor.header, size=self.error_type_size)
         cycle_map = """
+        constexpr std::size_t trial_count = {trials};
         std::array<std::uint64_t, {groups}> cycle_map{{}};
-        """.format(groups=len(self.groups))
-        source = [_UNIVERSAL_START, error_type,
-                  self._EXCEPTION_START, cycle_map]
+        std::array<cycle_statistics, {groups}> cycle_stats{{}};
+        std::array<std::array<std::uint32_t, trial_count>, {groups}>
+            trial_cycles{{}};
+        std::array<stack_depth, {groups}> stack_map{{}};
+        std::array<std::uint64_t, {groups}> happy_cycle_map{{}};
+        """.format(groups=len(self.groups), trials=self.trial_count)
+        start = self._EXCEPTION_START.format(
+            expected=self.flavor.expected("int"),
+            received=self.flavor.received("int"))
+        source = [_UNIVERSAL_START, error_type, start, cycle_map]
+
+        source.append(self.create_start())
+
+        for classes in self.classes:
+            source.append(classes.generate_result(self.error_type_size,
+                                                  self.flavor))
+
+        for index, function_group in enumerate(self.groups):
+            source.append(function_group.generate_result(
+                index, self.error_type_size, self.flavor))
+
+        return "\n".join(source)
+
+
+class gen_baseline_performance_application:
+    """
+    Control for the happy path: the same groups, classes and call chains as
+    the other applications with every error check removed, built with
+    -fno-exceptions. Its happy_cycles is the cost of the work itself, the
+    happy_cycles of except and result on top of it is what their error
+    handling costs when nothing fails.
+    """
+    _BASELINE_START = """
+    int start();
+    int main()
+    {
+        dwt_counter_enable();
+        enable_flash_accelerator();
+        volatile int return_code = 0;
+        return_code = start();
+        benchmark_halt();
+        return return_code;
+    }
+    """
+
+    def __init__(self,
+                 groups: List[gen_function_group],
+                 classes: List[gen_class],
+                 trial_count: int = 1,
+                 schedule: str = "round_robin"):
+        self.groups = groups
+        self.classes = classes
+        self.trial_count = trial_count
+        self.schedule = schedule
+
+    def create_start(self):
+        start_template = """
+        {forward_declarations}
+
+        using signature = int(void);
+
+        std::array<signature*, {function_count}> functions = {{
+            {function_list}
+        }};
+        int start() {{
+            happy_cycle_map.fill(0);
+            measure_call_latency();
+            {measure_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                happy_stats[index] = summarize(trial_cycles[index]);
+                happy_cycle_map[index] = happy_stats[index].median;
+            }}
+            // Deepest stack each call chain reaches
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                stack_paint();
+                auto stack_reference = stack_pointer();
+                functions[index]();
+                stack_map[index] = {{ stack_usage(stack_reference) }};
+            }}
+            export_csv("group_index,happy_cycles,stack_bytes,min,median,mean,"
+                       "max,p99", happy_cycle_map, stack_map, happy_stats);
+            return side_effect;
+        }}
+        """
+
+        forwards = []
+        calls = []
+
+        for index, group in enumerate(self.groups):
+            forwards.append(group.except_forward_declare_start(index))
+            calls.append(group.except_call_function_signature(index))
+
+        measure = """
+            start_cycles = uptime();
+            funct();
+            end_cycles = uptime();
+            trial_cycles[index][trial] =
+                elapsed_cycles(start_cycles, end_cycles);
+        """
+
+        return start_template.format(
+            forward_declarations="\n".join(forwards),
+            function_count=len(calls),
+            function_list=",".join(calls),
+            measure_loop=schedule_loop(self.schedule, "calls", measure))
+
+    def generate(self):
+        global _UNIVERSAL_START
+        cycle_map = """
+        constexpr std::size_t trial_count = {trials};
+        std::array<std::uint64_t, {groups}> happy_cycle_map{{}};
+        std::array<cycle_statistics, {groups}> happy_stats{{}};
+        std::array<std::array<std::uint32_t, trial_count>, {groups}>
+            trial_cycles{{}};
+        std::array<stack_depth, {groups}> stack_map{{}};
+        """.format(groups=len(self.groups), trials=self.trial_count)
+        source = [_UNIVERSAL_START, self._BASELINE_START, cycle_map]
 
         source.append(self.create_start())
 
         for classes in self.classes:
-            source.append(classes.generate_result())
+            source.append(classes.generate_baseline())
 
         for index, function_group in enumerate(self.groups):
-            source.append(function_group.generate_result(index))
+            source.append(function_group.generate_baseline(index))
 
         return "\n".join(source)
 
 
+class gen_hierarchy_performance_application(
+        gen_exception_performance_application):
+    """
+    Throws error hierarchies of increasing depth and width through the same
+    call chain and catches them by their root, once per hierarchy. Next to
+    the cycles of each throw it times the type match of the handler on its
+    own, match_permille is its share of the throw. Build it with and without
+    -frtti, exception type_info is emitted either way. Built with
+    GXX_PERSONALITY=1 it also throws each hierarchy again with the catch match
+    cache of gxx_personality.hpp warm, into cached_cycles. Other builds leave
+    cached_cycles empty.
+    """
+
+    def __init__(self,
+                 hierarchies: List[gen_error_hierarchy],
+                 call_depth: int = 12,
+                 trial_count: int = 1,
+                 schedule: str = "round_robin"):
+        self.hierarchies = hierarchies
+        self.call_depth = call_depth
+        self.trial_count = trial_count
+        self.schedule = schedule
+
+    def create_start(self):
+        start_template = """
+        using signature = std::uint32_t(void);
+
+        std::array<signature*, {count}> functions = {{
+            {catch_list}
+        }};
+        std::array<signature*, {count}> matches = {{
+            {match_list}
+        }};
+        constexpr std::array<std::uint64_t, {count}> depths = {{ {depths} }};
+        constexpr std::array<std::uint64_t, {count}> bases = {{ {bases} }};
+        constexpr std::array<std::uint64_t, {count}> polymorphic = {{
+            {polymorphic}
+        }};
+
+        int start() {{
+            measure_call_latency();
+            {measure_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                cycle_stats[index] = summarize(trial_cycles[index]);
+                cycle_map[index] = cycle_stats[index].median;
+            }}
+            {match_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                match_map[index] = summarize(trial_cycles[index]).median;
+                if (cycle_map[index] != 0) {{
+                    match_permille[index] =
+                        match_map[index] * 1000 / cycle_map[index];
+                }}
+            }}
+            #if GXX_PERSONALITY
+            // Warm catch_match_lookup_cache hits, see gxx_personality.hpp
+            catch_match_lookup_cache.clear();
+            catch_match_cache_enabled = true;
+            {cached_loop}
+            catch_match_cache_enabled = false;
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                cached_map[index] = summarize(trial_cycles[index]).median;
+            }}
+            #endif
+            export_csv("hierarchy,depth,bases,polymorphic,cycles,"
+                       "match_cycles,match_permille,cached_cycles,min,"
+                       "median,mean,max,p99",
+                       depths, bases, polymorphic, cycle_map, match_map,
+                       match_permille, cached_map, cycle_stats);
+            return 0;
+        }}
+        """
+
+        measure = """
+            trial_cycles[index][trial] = funct();
+        """
+        match_measure = """
+            trial_cycles[index][trial] = funct();
+        """
+        # The first throw of each hierarchy fills the cache
+        cached_measure = """
+            funct();
+            trial_cycles[index][trial] = funct();
+        """
+
+        return start_template.format(
+            count=len(self.hierarchies),
+            catch_list=",".join("catch_hierarchy{}".format(hierarchy.id)
+                                for hierarchy in self.hierarchies),
+            match_list=",".join("match_hierarchy{}".format(hierarchy.id)
+                                for hierarchy in self.hierarchies),
+            depths=",".join(str(hierarchy.depth)
+                            for hierarchy in self.hierarchies),
+            bases=",".join(str(hierarchy.bases)
+                           for hierarchy in self.hierarchies),
+            polymorphic=",".join(str(int(hierarchy.polymorphic))
+                                 for hierarchy in self.hierarchies),
+            measure_loop=schedule_loop(self.schedule, "throws", measure),
+            match_loop=schedule_loop(self.schedule, "matches", match_measure,
+                                     "matches"),
+            cached_loop=schedule_loop(self.schedule, "cached throws",
+                                      cached_measure))
+
+    def generate(self):
+        global _UNIVERSAL_START
+        cycle_map = """
+        constexpr std::size_t trial_count = {trials};
+        std::array<std::uint64_t, {count}> cycle_map{{}};
+        std::array<cycle_statistics, {count}> cycle_stats{{}};
+        std::array<std::array<std::uint32_t, trial_count>, {count}>
+            trial_cycles{{}};
+        std::array<std::uint64_t, {count}> match_map{{}};
+        std::array<std::uint64_t, {count}> match_permille{{}};
+        // Left empty without GXX_PERSONALITY, which has no match cache
+        std::array<std::optional<std::uint64_t>, {count}> cached_map{{}};
+        """.format(count=len(self.hierarchies), trials=self.trial_count)
+        includes = """
+        #include <cxxabi.h>
+        #include <typeinfo>
+        #if GXX_PERSONALITY
+        #include "gxx_personality.hpp"
+        #endif
+        """
+        source = [_UNIVERSAL_START, includes, self._EXCEPTION_START,
+                  cycle_map]
+
+        for hierarchy in self.hierarchies:
+            source.append(hierarchy.generate())
+            source.append(hierarchy.generate_functions(self.call_depth))
+
+        source.append(self.create_start())
+        return "\n".join(source)
+
+
+class gen_host_hierarchy_performance_application(
+        gen_hierarchy_performance_application):
+    _EXCEPTION_START = gen_host_exception_performance_application._EXCEPTION_START
+
+
+class gen_catch_site:
+    """
+    Chain of `depth` functions that throws from the last one and catches the
+    error `distance` frames up, in start() when the distance is the depth.
+    Between the thrower and the catch, `passes` frames have a handler for
+    another type and `rethrows` frames catch the error and rethrow it, spread
+    out evenly.
+    """
+
+    def __init__(self, depth: int, distance: int, passes: int = 0,
+                 rethrows: int = 0):
+        assert passes + rethrows < distance <= depth
+        self.depth = depth
+        self.distance = distance
+        self.passes = passes
+        self.rethrows = rethrows
+
+    def group(self, usage: gen_class_usage):
+        handlers = [call_handler.NONE] * self.depth
+        catch_index = self.depth - 1 - self.distance
+        if catch_index >= 0:
+            handlers[catch_index] = call_handler.CATCH
+
+        between = list(range(catch_index + 1, self.depth - 1))
+        count = self.passes + self.rethrows
+        for order in range(count):
+            index = between[order * len(between) // count]
+            handlers[index] = (call_handler.RETHROW if order < self.rethrows
+                               else call_handler.PASS)
+
+        return gen_function_group([
+            gen_function(usages=[usage], position=call_position.BOTTOM,
+                         handler=handler) for handler in handlers])
+
+
+class gen_catch_site_performance_application(
+        gen_exception_performance_application):
+    """
+    Throws through the chains of gen_catch_site and times each throw up to
+    the handler that catches it, wherever that is. Covers the cost of a
+    throw over the distance to its catch, over the number of frames with a
+    handler on the way and over the number of rethrows.
+    """
+
+    def __init__(self,
+                 error_type_size: int,
+                 catch_sites: List[gen_catch_site],
+                 trial_count: int = 1,
+                 schedule: str = "round_robin"):
+        self.error_type_size = error_type_size
+        self.catch_sites = catch_sites
+        self.trial_count = trial_count
+        self.schedule = schedule
+        # Only trivial classes, so the handlers are the only LSDAs
+        self.trivial_class = gen_class(id=0, nontrivial_dtor=False)
+        self.groups = [site.group(gen_class_usage(self.trivial_class, 1))
+                       for site in catch_sites]
+
+    def create_start(self):
+        start_template = """
+        {forward_declarations}
+
+        using signature = int(void);
+
+        std::array<signature*, {count}> functions = {{
+            {function_list}
+        }};
+        constexpr std::array<std::uint64_t, {count}> depths = {{ {depths} }};
+        constexpr std::array<std::uint64_t, {count}> distances = {{
+            {distances}
+        }};
+        constexpr std::array<std::uint64_t, {count}> passes = {{ {passes} }};
+        constexpr std::array<std::uint64_t, {count}> rethrows = {{
+            {rethrows}
+        }};
+
+        int start() {{
+            measure_call_latency();
+            {measure_loop}
+            for (std::size_t index = 0; index < functions.size(); index++) {{
+                cycle_stats[index] = summarize(trial_cycles[index]);
+                cycle_map[index] = cycle_stats[index].median;
+            }}
+            export_csv("catch_site,depth,distance,passes,rethrows,cycles,"
+                       "min,median,mean,max,p99",
+                       depths, distances, passes, rethrows, cycle_map,
+                       cycle_stats);
+            return 0;
+        }}
+        """
+
+        # The thrower sets start_cycles, and end_cycles is set by whichever
+        # handler catches the error
+        measure = """
+            side_effect = 1;
+            try {
+                funct();
+            } catch ([[maybe_unused]] const my_error_t& p_error) {
+                end_cycles = uptime();
+            }
+            trial_cycles[index][trial] =
+                elapsed_cycles(start_cycles, end_cycles);
+        """
+
+        return start_template.format(
+            forward_declarations="\n".join(
+                group.except_forward_declare_start(index)
+                for index, group in enumerate(self.groups)),
+            count=len(self.groups),
+            function_list=",".join(
+                group.except_call_function_signature(index)
+                for index, group in enumerate(self.groups)),
+            depths=",".join(str(site.depth) for site in self.catch_sites),
+            distances=",".join(str(site.distance)
+                               for site in self.catch_sites),
+            passes=",".join(str(site.passes) for site in self.catch_sites),
+            rethrows=",".join(str(site.rethrows)
+                              for site in self.catch_sites),
+            measure_loop=schedule_loop(self.schedule, "throws", measure))
+
+    def generate(self):
+        global _UNIVERSAL_START
+        error_types = """
+        struct my_error_t
+        {{
+            std::array<std::uint8_t, {size}> data;
+        }};
+        struct other_error_t
+        {{
+            std::uint32_t code;
+        }};
+        """.format(size=self.error_type_size)
+        cycle_map = """
+        constexpr std::size_t trial_count = {trials};
+        std::array<std::uint64_t, {count}> cycle_map{{}};
+        std::array<cycle_statistics, {count}> cycle_stats{{}};
+        std::array<std::array<std::uint32_t, trial_count>, {count}>
+            trial_cycles{{}};
+        """.format(count=len(self.groups), trials=self.trial_count)
+        source = [_UNIVERSAL_START, error_types, self._EXCEPTION_START,
+                  cycle_map, self.create_start(),
+                  self.trivial_class.generate_except(self.error_type_size)]
+
+        for index, function_group in enumerate(self.groups):
+            source.append(function_group.generate_except(
+                index, self.error_type_size))
+
+        return "\n".join(source)
+
+
+class gen_host_catch_site_performance_application(
+        gen_catch_site_performance_application):
+    _EXCEPTION_START = gen_host_exception_performance_application._EXCEPTION_START
+
+
+class gen_concurrent_performance_application(
+        gen_exception_performance_application):
+    """
+    Throws from 1 to max_tasks tasks at once, see tasks.hpp, and reports the
+    cycles per throw over all of them. Every fourth frame of the call chain
+    has a cleanup that yields, so on bare metal the other tasks throw while
+    one is half way through its own throw. The same tasks also allocate from
+    one exception_allocator for the cycles of an allocation and free.
+
+    Each task throws its index and checks it when it catches, and every
+    cleanup checks std::uncaught_exceptions(). `errors` counts what did not
+    match, which is what shared __cxa_eh_globals would get wrong.
+    """
+
+    def __init__(self,
+                 error_type_size: int,
+                 call_depth: int = 12,
+                 task_counts: List[int] = [1, 2, 4, 8],
+                 trial_count: int = 1):
+        self.error_type_size = error_type_size
+        self.call_depth = call_depth
+        self.task_counts = task_counts
+        self.trial_count = trial_count
+
+    def generate_functions(self):
+        source = ["""
+        std::atomic<std::uint32_t> errors = 0;
+
+        class yield_on_cleanup
+        {{
+        public:
+            ~yield_on_cleanup()
+            {{
+                if (std::uncaught_exceptions() != 1) {{
+                    errors++;
+                }}
+                task_yield();
+            }}
+        }};
+
+        [[gnu::noinline]] int concurrent_{index}(std::uint32_t p_task)
+        {{
+            if (p_task < max_tasks) {{
+                my_error_t error{{}};
+                error.data[0] = p_task;
+                throw error;
+            }}
+            return 0;
+        }}
+        """.format(index=self.call_depth - 1)]
+
+        for index in reversed(range(self.call_depth - 1)):
+            cleanup = "yield_on_cleanup cleanup;" if index % 4 == 3 else ""
+            source.append("""
+            [[gnu::noinline]] int concurrent_{index}(std::uint32_t p_task)
+            {{
+                {cleanup}
+                return concurrent_{next}(p_task) + 1;
+            }}
+            """.format(index=index, next=index + 1, cleanup=cleanup))
+
+        return "\n".join(source)
+
+    def create_start(self):
+        return """
+        constexpr std::size_t trials_per_task = trial_count;
+        exception_allocator<EXCEPTION_POOL_SIZE> task_pool;
+
+        void throwing_task(std::size_t p_task)
+        {{
+            for (std::size_t trial = 0; trial < trials_per_task; trial++) {{
+                try {{
+                    concurrent_0(p_task);
+                }} catch (const my_error_t& p_error) {{
+                    if (p_error.data[0] != p_task) {{
+                        errors++;
+                    }}
+                }}
+                task_yield();
+            }}
+        }}
+
+        void allocating_task(std::size_t)
+        {{
+            for (std::size_t trial = 0; trial < trials_per_task; trial++) {{
+                auto* memory = task_pool.allocate(sizeof(my_error_t));
+                task_yield();
+                if (memory == nullptr) {{
+                    errors++;
+                    continue;
+                }}
+                task_pool.free(memory);
+            }}
+        }}
+
+        constexpr std::array<std::uint64_t, {count}> task_counts = {{
+            {task_counts}
+        }};
+
+        int start() {{
+            measure_call_latency();
+            for (std::size_t row = 0; row < task_counts.size(); row++) {{
+                auto operations = task_counts[row] * trials_per_task;
+                std::uint32_t errors_before = errors;
+
+                start_cycles = uptime();
+                run_tasks(task_counts[row], throwing_task);
+                end_cycles = uptime();
+                throw_cycles[row] =
+                    elapsed_cycles(start_cycles, end_cycles) / operations;
+
+                start_cycles = uptime();
+                run_tasks(task_counts[row], allocating_task);
+                end_cycles = uptime();
+                allocation_cycles[row] =
+                    elapsed_cycles(start_cycles, end_cycles) / operations;
+
+                error_map[row] = errors - errors_before;
+            }}
+            export_csv("row,tasks,cycles_per_throw,cycles_per_allocation,"
+                       "errors",
+                       task_counts, throw_cycles, allocation_cycles,
+                       error_map);
+            return 0;
+        }}
+        """.format(count=len(self.task_counts),
+                   task_counts=",".join(str(count)
+                                        for count in self.task_counts))
+
+    def generate(self):
+        global _UNIVERSAL_START
+        assert max(self.task_counts) <= 8
+        error_type = """
+        #include <atomic>
+
+        #include "tasks.hpp"
+
+        struct my_error_t
+        {{
+            std::array<std::uint8_t, {size}> data;
+        }};
+        """.format(size=max(self.error_type_size, 1))
+        cycle_map = """
+        constexpr std::size_t trial_count = {trials};
+        std::array<std::uint64_t, {count}> throw_cycles{{}};
+        std::array<std::uint64_t, {count}> allocation_cycles{{}};
+        std::array<std::uint64_t, {count}> error_map{{}};
+        """.format(count=len(self.task_counts), trials=self.trial_count)
+        return "\n".join([_UNIVERSAL_START, error_type,
+                          self._EXCEPTION_START, cycle_map,
+                          self.generate_functions(), self.create_start()])
+
+
+class gen_host_concurrent_performance_application(
+        gen_concurrent_performance_application):
+    _EXCEPTION_START = gen_host_exception_performance_application._EXCEPTION_START
+
+
+class gen_host_storm_performance_application(
+        gen_host_exception_performance_application):
+    """
+    Throw storm for hosted builds: 1 to 64 threads throw through the same
+    call chain at once, like services that throw on every malformed packet.
+    Reports throws per second over all threads and per core in use, and the
+    cycles of every throw. Built with FDE_CACHE=1 the unwinder finds FDEs
+    through fde_cache.hpp instead of libgcc's lookup.
+    """
+
+    def __init__(self,
+                 error_type_size: int,
+                 call_depth: int = 12,
+                 thread_counts: List[int] = [1, 2, 4, 8, 16, 32, 64],
+                 throws_per_thread: int = 4096):
+        self.error_type_size = error_type_size
+        self.call_depth = call_depth
+        self.thread_counts = thread_counts
+        self.throws_per_thread = throws_per_thread
+
+    def generate_functions(self):
+        source = ["""
+        thread_local std::uint32_t cleanups = 0;
+
+        class storm_cleanup
+        {{
+        public:
+            ~storm_cleanup()
+            {{
+                cleanups = cleanups + 1;
+            }}
+        }};
+
+        [[gnu::noinline]] int storm_{index}(std::uint32_t p_thread)
+        {{
+            if (p_thread != UINT32_MAX) {{
+                throw my_error_t{{ .data = {{ {data} }} }};
+            }}
+            return 0;
+        }}
+        """.format(index=self.call_depth - 1,
+                   data=error_data([0xDE, 0xAD], self.error_type_size))]
+
+        for index in reversed(range(self.call_depth - 1)):
+            cleanup = "storm_cleanup cleanup;" if index % 4 == 3 else ""
+            source.append("""
+            [[gnu::noinline]] int storm_{index}(std::uint32_t p_thread)
+            {{
+                {cleanup}
+                return storm_{next}(p_thread) + 1;
+            }}
+            """.format(index=index, next=index + 1, cleanup=cleanup))
+
+        return "\n".join(source)
+
+    def create_start(self):
+        return """
+        constexpr std::size_t throws_per_thread = {throws};
+        constexpr std::array<std::uint64_t, {count}> thread_counts = {{
+            {thread_counts}
+        }};
+        std::array<std::uint64_t, {count}> core_map{{}};
+        std::array<std::uint64_t, {count}> throws_per_second{{}};
+        std::array<std::uint64_t, {count}> throws_per_core{{}};
+        std::array<cycle_statistics, {count}> cycle_stats{{}};
+        // Lookups fde_cache.hpp handed to libgcc, 0 when the snapshot answers
+        // every frame
+        std::array<std::uint64_t, {count}> miss_map{{}};
+        std::atomic<bool> go = false;
+
+        void storm_thread(std::uint32_t p_thread,
+                          std::span<std::uint32_t> p_cycles)
+        {{
+            while (!go.load(std::memory_order_acquire)) {{
+                std::this_thread::yield();
+            }}
+            for (auto& cycles : p_cycles) {{
+                auto start = uptime();
+                try {{
+                    storm_0(p_thread);
+                }} catch ([[maybe_unused]] const my_error_t& p_error) {{
+                }}
+                cycles = elapsed_cycles(start, uptime());
+            }}
+        }}
+
+        int start() {{
+            measure_call_latency();
+            std::uint64_t cores =
+                std::max(1u, std::thread::hardware_concurrency());
+            std::vector<std::uint32_t> samples;
+
+            for (std::size_t row = 0; row < thread_counts.size(); row++) {{
+                auto count = thread_counts[row];
+                samples.assign(count * throws_per_thread, 0);
+                go = false;
+
+                std::vector<std::thread> threads;
+                for (std::uint32_t index = 0; index < count; index++) {{
+                    threads.emplace_back(
+                        storm_thread, index,
+                        std::span(samples).subspan(index * throws_per_thread,
+                                                   throws_per_thread));
+                }}
+                #if FDE_CACHE
+                std::uint32_t misses_before = fde_cache_misses;
+                #endif
+                auto begin = std::chrono::steady_clock::now();
+                go.store(true, std::memory_order_release);
+                for (auto& thread : threads) {{
+                    thread.join();
+                }}
+                std::chrono::duration<double> seconds =
+                    std::chrono::steady_clock::now() - begin;
+
+                core_map[row] = std::min(count, cores);
+                throws_per_second[row] = static_cast<std::uint64_t>(
+                    samples.size() / seconds.count());
+                throws_per_core[row] = throws_per_second[row] / core_map[row];
+                cycle_stats[row] = summarize(samples);
+                #if FDE_CACHE
+                miss_map[row] = fde_cache_misses - misses_before;
+                #endif
+            }}
+
+            #if FDE_CACHE
+            export_csv("row,threads,cores,throws_per_second,"
+                       "throws_per_second_per_core,min,median,mean,max,p99,"
+                       "fde_cache_misses",
+                       thread_counts, core_map, throws_per_second,
+                       throws_per_core, cycle_stats, miss_map);
+            #else
+            export_csv("row,threads,cores,throws_per_second,"
+                       "throws_per_second_per_core,min,median,mean,max,p99",
+                       thread_counts, core_map, throws_per_second,
+                       throws_per_core, cycle_stats);
+            #endif
+            return 0;
+        }}
+        """.format(throws=self.throws_per_thread,
+                   count=len(self.thread_counts),
+                   thread_counts=",".join(str(count)
+                                          for count in self.thread_counts))
+
+    def generate(self):
+        global _UNIVERSAL_START
+        error_type = """
+        #include <atomic>
+        #include <chrono>
+        #include <thread>
+        #include <vector>
+
+        #if FDE_CACHE
+        #include "fde_cache.hpp"
+
+        extern "C" const void* __wrap__Unwind_Find_FDE(
+            void* p_pc, dwarf_eh_bases* p_bases)  // NOLINT
+        {{
+            return fde_cache_find(p_pc, p_bases);
+        }}
+        #endif
+
+        struct my_error_t
+        {{
+            std::array<std::uint8_t, {size}> data;
+        }};
+        """.format(size=self.error_type_size)
+        return "\n".join([_UNIVERSAL_START, error_type,
+                          self._EXCEPTION_START, self.generate_functions(),
+                          self.create_start()])
+
+
+def generate_catch_sites():
+    depth = 24
+    sites = []
+    # Caught further and further up, the last one in start()
+    for distance in [1, 2, 4, 8, 16, 23, 24]:
+        sites.append(gen_catch_site(depth=depth, distance=distance))
+    # Handlers for another type on the way to start()
+    for passes in [1, 2, 4, 8, 16]:
+        sites.append(gen_catch_site(depth=depth, distance=depth,
+                                    passes=passes))
+    # Caught and rethrown on the way to start()
+    for rethrows in [1, 2, 4, 8]:
+        sites.append(gen_catch_site(depth=depth, distance=depth,
+                                    rethrows=rethrows))
+    return sites
+
+
+def generate_hierarchies():
+    hierarchies = [gen_error_hierarchy(id=0, depth=0, bases=1,
+                                       polymorphic=False),
+                   gen_error_hierarchy(id=1, depth=0, bases=1,
+                                       polymorphic=True)]
+    for polymorphic in [False, True]:
+        for bases in [1, 2, 4]:
+            for depth in [1, 2, 4, 8]:
+                hierarchies.append(gen_error_hierarchy(
+                    id=len(hierarchies), depth=depth, bases=bases,
+                    polymorphic=polymorphic))
+    return hierarchies
+
+
 def generate_app():
     trivial_class = gen_class(id=0, nontrivial_dtor=False)
     nontrivial_class = gen_class(id=1, nontrivial_dtor=True)
@@ -802,17 +2058,113 @@ def generate_app():
     return (group_list, [trivial_class, nontrivial_class])
 
 
-def generate():
+def generate(args):
     app = generate_app()
-    except_source = gen_exception_performance_application(error_type_size=4,
-                                                          groups=app[0],
-                                                          classes=app[1]).generate()
-    Path(f"except.cpp").write_text(except_source)
-    result_file_source = gen_result_performance_application(error_type_size=4,
-                                                            groups=app[0],
-                                                            classes=app[1]).generate()
-    Path(f"result.cpp").write_text(result_file_source)
+    if args.platform == "host":
+        except_application = gen_host_exception_performance_application
+    else:
+        except_application = gen_exception_performance_application
+    except_source = except_application(error_type_size=args.error_size,
+                                       groups=app[0],
+                                       classes=app[1],
+                                       trial_count=args.trials,
+                                       schedule=args.schedule).generate()
+    Path(args.output_dir / "except.cpp").write_text(except_source)
+    # The result application has no bare metal shims, platform.hpp takes care
+    # of the timer so the same source builds for every platform. One source
+    # per result flavor, result.cpp is tl::expected.
+    for name, flavor in RESULT_FLAVORS.items():
+        path = args.output_dir / ("result.cpp" if name == "tl"
+                                  else "result_{}.cpp".format(name))
+        if name == "packed" and args.error_size > 4:
+            # packed_result.hpp fits the error into a register
+            path.unlink(missing_ok=True)
+            continue
+        result_file_source = gen_result_performance_application(
+            error_type_size=args.error_size,
+            groups=app[0],
+            classes=app[1],
+            trial_count=args.trials,
+            schedule=args.schedule,
+            flavor=flavor).generate()
+        path.write_text(result_file_source)
+    baseline_source = gen_baseline_performance_application(
+        groups=app[0],
+        classes=app[1],
+        trial_count=args.trials,
+        schedule=args.schedule).generate()
+    Path(args.output_dir / "baseline.cpp").write_text(baseline_source)
+
+    if args.platform == "host":
+        hierarchy_application = gen_host_hierarchy_performance_application
+    else:
+        hierarchy_application = gen_hierarchy_performance_application
+    hierarchy_source = hierarchy_application(
+        hierarchies=generate_hierarchies(),
+        trial_count=args.trials,
+        schedule=args.schedule).generate()
+    Path(args.output_dir / "hierarchy.cpp").write_text(hierarchy_source)
+
+    if args.platform == "host":
+        catch_site_application = gen_host_catch_site_performance_application
+    else:
+        catch_site_application = gen_catch_site_performance_application
+    catch_site_source = catch_site_application(
+        error_type_size=args.error_size,
+        catch_sites=generate_catch_sites(),
+        trial_count=args.trials,
+        schedule=args.schedule).generate()
+    Path(args.output_dir / "catch_site.cpp").write_text(catch_site_source)
+
+    if args.platform == "host":
+        concurrent_application = gen_host_concurrent_performance_application
+    else:
+        concurrent_application = gen_concurrent_performance_application
+    concurrent_source = concurrent_application(
+        error_type_size=args.error_size,
+        trial_count=args.trials).generate()
+    Path(args.output_dir / "concurrent.cpp").write_text(concurrent_source)
+
+    if args.platform == "host":
+        storm_source = gen_host_storm_performance_application(
+            error_type_size=args.error_size).generate()
+        Path(args.output_dir / "storm.cpp").write_text(storm_source)
 
 
 if __name__ == "__main__":
-    generate()
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-p", "--platform",
+                        help="Target platform. 'lpc4078' emits the bare metal "
+                        "runtime (also used for QEMU), 'host' emits a "
+                        "benchmark for hosted Linux using the system's "
+                        "unwinder.",
+                        choices=["lpc4078", "host"],
+                        default="lpc4078")
+    parser.add_argument("-o", "--output_dir",
+                        help="Directory to write except.cpp, result.cpp, "
+                        "baseline.cpp, hierarchy.cpp, catch_site.cpp, "
+                        "concurrent.cpp and, for the host, storm.cpp to.",
+                        default=Path("."),
+                        type=Path)
+    parser.add_argument("-t", "--trials",
+                        help="Number of times each group is measured. "
+                        "cycle_map holds the median and cycle_stats holds "
+                        "min/median/mean/max/p99 of the trials. p99 is "
+                        "left empty below 100 trials, where it is the max.",
+                        default=100,
+                        type=int)
+    parser.add_argument("-e", "--error_size",
+                        help="Size of my_error_t in bytes, for both except.cpp "
+                        "and result.cpp. error_size_sweep.py runs the groups "
+                        "over a range of sizes.",
+                        default=4,
+                        type=int)
+    parser.add_argument("-s", "--schedule",
+                        help="Order of the trials. 'round_robin' measures "
+                        "every group once per pass, 'repeated' measures each "
+                        "group's trials back to back so the unwinder sees "
+                        "the same throw over and over.",
+                        choices=["round_robin", "repeated"],
+                        default="round_robin")
+    args = parser.parse_args()
+    generate(args)
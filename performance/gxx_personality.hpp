@@ -0,0 +1,496 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The ARM EHABI __gxx_personality_v0 of libsupc++ (eh_personality.cc), with
+// its catch type matching behind catch_match_cache. Defining it takes the
+// place of libsupc++'s, so include this header in exactly one translation
+// unit of an image.
+//
+// Dynamic exception specifications are gone since C++17, so a negative
+// filter is treated as an empty throw() and its landing pad is left to call
+// __cxa_call_unexpected. Foreign exceptions only match catch (...).
+
+#pragma once
+
+#include <unwind.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <typeinfo>
+
+#include "catch_match_cache.hpp"
+#include "exception_allocator.hpp"
+
+#if defined(__ARM_EABI_UNWINDER__)
+
+catch_match_cache<CATCH_MATCH_CACHE_SIZE> catch_match_lookup_cache;
+/// Consult catch_match_lookup_cache before calling __do_catch
+std::atomic<bool> catch_match_cache_enabled = false;
+
+namespace gxx_personality {
+constexpr int unwind_pointer_register = 12;
+constexpr int unwind_stack_register = 13;
+
+// DWARF pointer encodings of the LSDA
+constexpr std::uint8_t pe_absptr = 0x00;
+constexpr std::uint8_t pe_omit = 0xff;
+constexpr std::uint8_t pe_uleb128 = 0x01;
+constexpr std::uint8_t pe_udata2 = 0x02;
+constexpr std::uint8_t pe_udata4 = 0x03;
+constexpr std::uint8_t pe_udata8 = 0x04;
+constexpr std::uint8_t pe_sleb128 = 0x09;
+constexpr std::uint8_t pe_sdata2 = 0x0A;
+constexpr std::uint8_t pe_sdata4 = 0x0B;
+constexpr std::uint8_t pe_sdata8 = 0x0C;
+constexpr std::uint8_t pe_pcrel = 0x10;
+constexpr std::uint8_t pe_indirect = 0x80;
+
+struct lsda_header
+{
+  _Unwind_Ptr start;
+  _Unwind_Ptr landing_pad_start;
+  _Unwind_Ptr ttype_base;
+  const std::uint8_t* ttype;
+  const std::uint8_t* action_table;
+  std::uint8_t ttype_encoding;
+  std::uint8_t call_site_encoding;
+};
+
+inline const std::uint8_t*
+read_uleb128(const std::uint8_t* p, std::uint32_t* p_value)
+{
+  std::uint32_t result = 0;
+  unsigned shift = 0;
+  std::uint8_t byte;
+  do {
+    byte = *p++;
+    result |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  *p_value = result;
+  return p;
+}
+
+inline const std::uint8_t*
+read_sleb128(const std::uint8_t* p, std::int32_t* p_value)
+{
+  std::uint32_t result = 0;
+  unsigned shift = 0;
+  std::uint8_t byte;
+  do {
+    byte = *p++;
+    result |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  if (shift < 32 && (byte & 0x40)) {
+    result |= ~std::uint32_t{ 0 } << shift;
+  }
+  *p_value = static_cast<std::int32_t>(result);
+  return p;
+}
+
+template<typename T>
+inline T
+read_unaligned(const std::uint8_t* p)
+{
+  T value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+/// Every base the ARM LSDA uses is 0, pc relative values are handled here
+inline const std::uint8_t*
+read_encoded_value(std::uint8_t p_encoding,
+                   const std::uint8_t* p,
+                   _Unwind_Ptr* p_value)
+{
+  const auto* start = p;
+  _Unwind_Ptr result = 0;
+
+  switch (p_encoding & 0x0f) {
+    case pe_absptr:
+    case pe_udata4:
+      result = read_unaligned<std::uint32_t>(p);
+      p += 4;
+      break;
+    case pe_uleb128: {
+      std::uint32_t value;
+      p = read_uleb128(p, &value);
+      result = value;
+      break;
+    }
+    case pe_sleb128: {
+      std::int32_t value;
+      p = read_sleb128(p, &value);
+      result = static_cast<_Unwind_Ptr>(value);
+      break;
+    }
+    case pe_udata2:
+      result = read_unaligned<std::uint16_t>(p);
+      p += 2;
+      break;
+    case pe_sdata2:
+      result = static_cast<_Unwind_Ptr>(read_unaligned<std::int16_t>(p));
+      p += 2;
+      break;
+    case pe_sdata4:
+      result = static_cast<_Unwind_Ptr>(read_unaligned<std::int32_t>(p));
+      p += 4;
+      break;
+    case pe_udata8:
+    case pe_sdata8:
+      result = static_cast<_Unwind_Ptr>(read_unaligned<std::uint64_t>(p));
+      p += 8;
+      break;
+    default:
+      std::terminate();
+  }
+
+  if (result != 0) {
+    if ((p_encoding & 0x70) == pe_pcrel) {
+      result += reinterpret_cast<_Unwind_Ptr>(start);
+    }
+    if (p_encoding & pe_indirect) {
+      result = *reinterpret_cast<const _Unwind_Ptr*>(result);
+    }
+  }
+
+  *p_value = result;
+  return p;
+}
+
+inline const std::uint8_t*
+parse_lsda_header(_Unwind_Context* p_context,
+                  const std::uint8_t* p,
+                  lsda_header* p_header)
+{
+  p_header->start = _Unwind_GetRegionStart(p_context);
+  p_header->ttype_base = 0;
+
+  std::uint8_t landing_pad_encoding = *p++;
+  if (landing_pad_encoding != pe_omit) {
+    p = read_encoded_value(
+      landing_pad_encoding, p, &p_header->landing_pad_start);
+  } else {
+    p_header->landing_pad_start = p_header->start;
+  }
+
+  p_header->ttype_encoding = *p++;
+  if (p_header->ttype_encoding != pe_omit) {
+    std::uint32_t offset;
+    p = read_uleb128(p, &offset);
+    p_header->ttype = p + offset;
+  } else {
+    p_header->ttype = nullptr;
+  }
+
+  p_header->call_site_encoding = *p++;
+  std::uint32_t length;
+  p = read_uleb128(p, &length);
+  p_header->action_table = p + length;
+  return p;
+}
+
+inline const std::type_info*
+ttype_entry(const lsda_header& p_header, std::int32_t p_filter)
+{
+  auto entry = reinterpret_cast<_Unwind_Word>(p_header.ttype - p_filter * 4);
+  return reinterpret_cast<const std::type_info*>(
+    _Unwind_decode_typeinfo_ptr(p_header.ttype_base, entry));
+}
+
+inline bool
+is_gxx_exception(const _Unwind_Control_Block* p_ue_header)
+{
+  // "GNUCC++\0" for a thrown object, "GNUCC++\x01" for one rethrown from
+  // an exception_ptr
+  return std::memcmp(p_ue_header->exception_class, "GNUCC++", 7) == 0 &&
+         (p_ue_header->exception_class[7] == 0 ||
+          p_ue_header->exception_class[7] == 1);
+}
+
+inline void*
+thrown_object(_Unwind_Control_Block* p_ue_header)
+{
+  void* object = p_ue_header + 1;
+  if (p_ue_header->exception_class[7] == 1) {
+    // __cxa_dependent_exception is laid out like __cxa_exception, its
+    // primaryException sits where exceptionType would be.
+    constexpr auto offset =
+      exception_header_size -
+      offsetof(cxa_refcounted_exception_layout, exception_type);
+    object = *reinterpret_cast<void**>(static_cast<std::uint8_t*>(object) -
+                                       offset);
+  }
+  return object;
+}
+
+inline const std::type_info*
+thrown_type(void* p_thrown_object)
+{
+  auto* header = reinterpret_cast<cxa_refcounted_exception_layout*>(
+    static_cast<std::uint8_t*>(p_thrown_object) - exception_header_size);
+  return header->exception_type;
+}
+
+/// libsupc++'s get_adjusted_ptr, with the class type results cached
+inline bool
+adjusted_pointer(const std::type_info* p_caught,
+                 const std::type_info* p_thrown,
+                 void** p_thrown_object)
+{
+  if (catch_match_cache_enabled) {
+    catch_match_cache<CATCH_MATCH_CACHE_SIZE>::entry entry;
+    if (catch_match_lookup_cache.find(p_thrown, p_caught, entry)) {
+      if (entry.matched) {
+        *p_thrown_object =
+          static_cast<std::uint8_t*>(*p_thrown_object) + entry.adjustment;
+      }
+      return entry.matched;
+    }
+  }
+
+  void* object = *p_thrown_object;
+  const bool is_pointer = p_thrown->__is_pointer_p();
+  if (is_pointer) {
+    object = *static_cast<void**>(object);
+  }
+  const bool matched = p_caught->__do_catch(p_thrown, &object, 1);
+
+  // Pointers are matched and adjusted by value, so the adjustment depends on
+  // the object they point to and is not cached.
+  if (catch_match_cache_enabled && !is_pointer) {
+    catch_match_lookup_cache.insert(
+      p_thrown,
+      p_caught,
+      matched,
+      matched ? static_cast<std::uint8_t*>(object) -
+                  static_cast<std::uint8_t*>(*p_thrown_object)
+              : 0);
+  }
+  if (matched) {
+    *p_thrown_object = object;
+  }
+  return matched;
+}
+} // namespace gxx_personality
+
+extern "C"
+{
+  bool __cxa_begin_cleanup(_Unwind_Control_Block* p_ue_header); // NOLINT
+
+  // NOLINTNEXTLINE
+  _Unwind_Reason_Code __gxx_personality_v0(_Unwind_State p_state,
+                                           _Unwind_Control_Block* p_ue_header,
+                                           _Unwind_Context* p_context)
+  {
+    using namespace gxx_personality;
+
+    enum found_type
+    {
+      found_nothing,
+      found_terminate,
+      found_cleanup,
+      found_handler,
+    };
+
+    auto continue_unwinding = [p_ue_header, p_context]() {
+      if (__gnu_unwind_frame(p_ue_header, p_context) != _URC_OK) {
+        return _URC_FAILURE;
+      }
+      return _URC_CONTINUE_UNWIND;
+    };
+
+    _Unwind_Action actions;
+    switch (p_state & _US_ACTION_MASK) {
+      case _US_VIRTUAL_UNWIND_FRAME:
+        if (p_state & _US_FORCE_UNWIND) {
+          return continue_unwinding();
+        }
+        actions = _UA_SEARCH_PHASE;
+        break;
+      case _US_UNWIND_FRAME_STARTING:
+        actions = _UA_CLEANUP_PHASE;
+        if (!(p_state & _US_FORCE_UNWIND) &&
+            p_ue_header->barrier_cache.sp ==
+              _Unwind_GetGR(p_context, unwind_stack_register)) {
+          actions |= _UA_HANDLER_FRAME;
+        }
+        break;
+      case _US_UNWIND_FRAME_RESUME:
+        return continue_unwinding();
+      default:
+        std::terminate();
+    }
+    actions |= p_state & _US_FORCE_UNWIND;
+
+    const bool foreign_exception = !is_gxx_exception(p_ue_header);
+
+    // The personality routine finds the UCB through this scratch register
+    _Unwind_SetGR(p_context,
+                  unwind_pointer_register,
+                  reinterpret_cast<_Unwind_Ptr>(p_ue_header));
+
+    found_type found;
+    std::int32_t handler_switch_value = 0;
+    _Unwind_Ptr landing_pad = 0;
+    const std::uint8_t* language_specific_data = nullptr;
+    void* object = nullptr;
+
+    if (actions == (_UA_CLEANUP_PHASE | _UA_HANDLER_FRAME) &&
+        !foreign_exception) {
+      // Phase 1 found the handler in this frame and saved what it found
+      handler_switch_value =
+        static_cast<std::int32_t>(p_ue_header->barrier_cache.bitpattern[1]);
+      landing_pad = p_ue_header->barrier_cache.bitpattern[3];
+      found = (landing_pad == 0) ? found_terminate : found_handler;
+    } else {
+      language_specific_data = static_cast<const std::uint8_t*>(
+        _Unwind_GetLanguageSpecificData(p_context));
+      if (language_specific_data == nullptr) {
+        return continue_unwinding();
+      }
+
+      lsda_header header;
+      const auto* p =
+        parse_lsda_header(p_context, language_specific_data, &header);
+      // The return address, back onto the call instruction
+      _Unwind_Ptr ip = _Unwind_GetIP(p_context) - 1;
+      const std::uint8_t* action_record = nullptr;
+
+      // The call site table is sorted by address
+      bool in_table = false;
+      while (p < header.action_table) {
+        _Unwind_Ptr call_site_start;
+        _Unwind_Ptr call_site_length;
+        _Unwind_Ptr call_site_landing_pad;
+        std::uint32_t call_site_action;
+        p = read_encoded_value(header.call_site_encoding, p, &call_site_start);
+        p = read_encoded_value(header.call_site_encoding, p, &call_site_length);
+        p = read_encoded_value(
+          header.call_site_encoding, p, &call_site_landing_pad);
+        p = read_uleb128(p, &call_site_action);
+
+        if (ip < header.start + call_site_start) {
+          break;
+        }
+        if (ip < header.start + call_site_start + call_site_length) {
+          if (call_site_landing_pad) {
+            landing_pad = header.landing_pad_start + call_site_landing_pad;
+          }
+          if (call_site_action) {
+            action_record = header.action_table + call_site_action - 1;
+          }
+          in_table = true;
+          break;
+        }
+      }
+
+      if (!in_table) {
+        // A throw out of a cleanup or a noexcept function
+        found = found_terminate;
+      } else if (landing_pad == 0) {
+        found = found_nothing;
+      } else if (action_record == nullptr) {
+        found = found_cleanup;
+      } else {
+        const std::type_info* thrown = nullptr;
+        if (!foreign_exception && !(actions & _UA_FORCE_UNWIND)) {
+          object = thrown_object(p_ue_header);
+          thrown = thrown_type(object);
+        }
+
+        bool saw_cleanup = false;
+        bool saw_handler = false;
+        std::int32_t filter = 0;
+        while (true) {
+          std::int32_t displacement;
+          p = read_sleb128(action_record, &filter);
+          read_sleb128(p, &displacement);
+
+          if (filter == 0) {
+            saw_cleanup = true;
+          } else if (filter > 0) {
+            const auto* caught = ttype_entry(header, filter);
+            // A null type is catch (...)
+            if (caught == nullptr ||
+                (thrown != nullptr &&
+                 adjusted_pointer(caught, thrown, &object))) {
+              saw_handler = true;
+              break;
+            }
+          } else {
+            saw_handler = true;
+            break;
+          }
+
+          if (displacement == 0) {
+            break;
+          }
+          action_record = p + displacement;
+        }
+
+        if (saw_handler) {
+          handler_switch_value = filter;
+          found = found_handler;
+        } else {
+          found = saw_cleanup ? found_cleanup : found_nothing;
+        }
+      }
+
+      if (found == found_nothing) {
+        return continue_unwinding();
+      }
+
+      if (found == found_cleanup) {
+        if (actions & _UA_SEARCH_PHASE) {
+          return continue_unwinding();
+        }
+      } else if (!foreign_exception) {
+        // For phase 2 and __cxa_begin_catch. A single phase unwind finds
+        // the handler in phase 2, see except_experimental.cpp.
+        p_ue_header->barrier_cache.sp =
+          _Unwind_GetGR(p_context, unwind_stack_register);
+        p_ue_header->barrier_cache.bitpattern[0] =
+          reinterpret_cast<_uw>(object);
+        p_ue_header->barrier_cache.bitpattern[1] =
+          static_cast<_uw>(handler_switch_value);
+        p_ue_header->barrier_cache.bitpattern[2] =
+          reinterpret_cast<_uw>(language_specific_data);
+        p_ue_header->barrier_cache.bitpattern[3] = landing_pad;
+      }
+
+      if (actions & _UA_SEARCH_PHASE) {
+        return _URC_HANDLER_FOUND;
+      }
+    }
+
+    if (found == found_terminate) {
+      std::terminate();
+    }
+
+    _Unwind_SetGR(p_context, 0, reinterpret_cast<_Unwind_Ptr>(p_ue_header));
+    _Unwind_SetGR(p_context, 1, static_cast<_Unwind_Ptr>(handler_switch_value));
+    _Unwind_SetIP(p_context, landing_pad);
+    if (found == found_cleanup) {
+      __cxa_begin_cleanup(p_ue_header);
+    }
+    return _URC_INSTALL_CONTEXT;
+  }
+} // extern "C"
+
+#endif
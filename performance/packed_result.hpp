@@ -0,0 +1,149 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Result of a function, returned in r0/r1
+ *
+ * The AAPCS returns a composite type larger than 4 bytes in memory, at an
+ * address the caller passes in r0, so tl::expected<int, E> and
+ * std::expected<int, E> are stored and loaded again by every frame an error
+ * passes through. An enumeration is returned like its underlying type, so
+ * functions return packed_bits: the value or error in r0 and 0 for a value
+ * or 1 for an error in r1. The caller unpacks it into a packed_result, which
+ * stays in registers as well.
+ *
+ *   packed_bits funct()
+ *   {
+ *     if (packed_result<int, my_error_t> result = other(); !result) {
+ *       return packed_error(result.error());
+ *     }
+ *     return packed_value(42);
+ *   }
+ *
+ * Values and errors have to be trivially copyable and fit in 4 bytes.
+ */
+enum class packed_bits : std::uint64_t
+{
+};
+
+namespace packed_detail {
+inline constexpr std::uint64_t error_flag = std::uint64_t{ 1 } << 32;
+
+template<typename T>
+inline constexpr bool packable =
+  std::is_trivially_copyable_v<T> && sizeof(T) <= 4;
+
+// packed_result<void, E> only carries the error
+template<>
+inline constexpr bool packable<void> = true;
+
+template<typename T>
+inline std::uint32_t
+to_word(const T& p_object)
+{
+  std::uint32_t word = 0;
+  std::memcpy(&word, &p_object, sizeof(T));
+  return word;
+}
+
+template<typename T>
+inline T
+from_word(std::uint32_t p_word)
+{
+  T object;
+  std::memcpy(&object, &p_word, sizeof(T));
+  return object;
+}
+}  // namespace packed_detail
+
+/// Return value of a failed packed_bits function, like tl::unexpected
+template<typename E>
+struct packed_error
+{
+  static_assert(packed_detail::packable<E>,
+                "The error must be trivially copyable and fit in 4 bytes");
+
+  E error;
+
+  operator packed_bits() const
+  {
+    return packed_bits{ packed_detail::error_flag |
+                        packed_detail::to_word(error) };
+  }
+};
+
+template<typename E>
+packed_error(E) -> packed_error<E>;
+
+/// Return value of a successful packed_bits function
+template<typename T>
+inline packed_bits
+packed_value(T p_value)
+{
+  static_assert(packed_detail::packable<T>,
+                "The value must be trivially copyable and fit in 4 bytes");
+  return packed_bits{ packed_detail::to_word(p_value) };
+}
+
+inline packed_bits
+packed_value()
+{
+  return packed_bits{ 0 };
+}
+
+/// packed_bits unpacked by the caller, used like tl::expected<T, E>
+template<typename T, typename E>
+class packed_result
+{
+public:
+  static_assert(packed_detail::packable<T>,
+                "The value must be trivially copyable and fit in 4 bytes");
+  static_assert(packed_detail::packable<E>,
+                "The error must be trivially copyable and fit in 4 bytes");
+
+  packed_result(packed_bits p_bits)
+    : m_bits(static_cast<std::uint64_t>(p_bits))
+  {
+  }
+
+  bool has_value() const
+  {
+    return (m_bits & packed_detail::error_flag) == 0;
+  }
+
+  explicit operator bool() const
+  {
+    return has_value();
+  }
+
+  T value() const
+    requires(!std::is_void_v<T>)
+  {
+    return packed_detail::from_word<T>(static_cast<std::uint32_t>(m_bits));
+  }
+
+  E error() const
+  {
+    return packed_detail::from_word<E>(static_cast<std::uint32_t>(m_bits));
+  }
+
+private:
+  std::uint64_t m_bits;
+};
@@ -0,0 +1,471 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if !defined(__arm__)
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+#endif
+
+// Platform layer shared by the performance benchmarks.
+//
+// Three platforms are supported:
+//
+//   - LPC4078 (default): cycles are read from the DWT cycle counter and results
+//     are left in RAM (`cycle_map`, `happy_cycle_map`, ...) for GDB to inspect.
+//   - QEMU mps2-an386 (BENCHMARK_QEMU=1): QEMU does not model the DWT, so time
+//     is read from SysTick clocked by the core clock. When QEMU runs with
+//     `-icount shift=0` the virtual clock advances 1ns per instruction, which
+//     makes every reading deterministic. Results are written to a CSV file on
+//     the host through semihosting and the application exits through
+//     semihosting as well.
+//   - Host (any non-ARM build, BENCHMARK_HOST=1): time is read from the time
+//     stamp counter on x86-64 or from CLOCK_MONOTONIC (nanoseconds) elsewhere
+//     and results are written with stdio.
+
+#if !defined(BENCHMARK_QEMU)
+#define BENCHMARK_QEMU 0
+#endif
+
+#if !defined(__arm__)
+#define BENCHMARK_HOST 1
+#else
+#define BENCHMARK_HOST 0
+#endif
+
+#if !defined(BENCHMARK_OUTPUT)
+#define BENCHMARK_OUTPUT "cycle_map.csv"
+#endif
+
+/// Structure type to access the Data Watch point and Trace Register (DWT).
+struct dwt_register_t
+{
+  /// Offset: 0x000 (R/W)  Control Register
+  volatile uint32_t ctrl;
+  /// Offset: 0x004 (R/W)  Cycle Count Register
+  volatile uint32_t cyccnt;
+  /// Offset: 0x008 (R/W)  CPI Count Register
+  volatile uint32_t cpicnt;
+  /// Offset: 0x00C (R/W)  Exception Overhead Count Register
+  volatile uint32_t exccnt;
+  /// Offset: 0x010 (R/W)  Sleep Count Register
+  volatile uint32_t sleepcnt;
+  /// Offset: 0x014 (R/W)  LSU Count Register
+  volatile uint32_t lsucnt;
+  /// Offset: 0x018 (R/W)  Folded-instruction Count Register
+  volatile uint32_t foldcnt;
+  /// Offset: 0x01C (R/ )  Program Counter Sample Register
+  volatile const uint32_t pcsr;
+  /// Offset: 0x020 (R/W)  Comparator Register 0
+  volatile uint32_t comp0;
+  /// Offset: 0x024 (R/W)  Mask Register 0
+  volatile uint32_t mask0;
+  /// Offset: 0x028 (R/W)  Function Register 0
+  volatile uint32_t function0;
+  /// Reserved 0
+  std::array<uint32_t, 1> reserved0;
+  /// Offset: 0x030 (R/W)  Comparator Register 1
+  volatile uint32_t comp1;
+  /// Offset: 0x034 (R/W)  Mask Register 1
+  volatile uint32_t mask1;
+  /// Offset: 0x038 (R/W)  Function Register 1
+  volatile uint32_t function1;
+  /// Reserved 1
+  std::array<uint32_t, 1> reserved1;
+  /// Offset: 0x040 (R/W)  Comparator Register 2
+  volatile uint32_t comp2;
+  /// Offset: 0x044 (R/W)  Mask Register 2
+  volatile uint32_t mask2;
+  /// Offset: 0x048 (R/W)  Function Register 2
+  volatile uint32_t function2;
+  /// Reserved 2
+  std::array<uint32_t, 1> reserved2;
+  /// Offset: 0x050 (R/W)  Comparator Register 3
+  volatile uint32_t comp3;
+  /// Offset: 0x054 (R/W)  Mask Register 3
+  volatile uint32_t mask3;
+  /// Offset: 0x058 (R/W)  Function Register 3
+  volatile uint32_t function3;
+};
+
+/// Structure type to access the Core Debug Register (CoreDebug)
+struct core_debug_registers_t
+{
+  /// Offset: 0x000 (R/W)  Debug Halting Control and Status Register
+  volatile uint32_t dhcsr;
+  /// Offset: 0x004 ( /W)  Debug Core Register Selector Register
+  volatile uint32_t dcrsr;
+  /// Offset: 0x008 (R/W)  Debug Core Register Data Register
+  volatile uint32_t dcrdr;
+  /// Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register
+  volatile uint32_t demcr;
+};
+
+/// Structure type to access the System Timer (SysTick)
+struct systick_register_t
+{
+  /// Offset: 0x000 (R/W)  SysTick Control and Status Register
+  volatile uint32_t ctrl;
+  /// Offset: 0x004 (R/W)  SysTick Reload Value Register
+  volatile uint32_t load;
+  /// Offset: 0x008 (R/W)  SysTick Current Value Register
+  volatile uint32_t val;
+  /// Offset: 0x00C (R/ )  SysTick Calibration Register
+  volatile const uint32_t calib;
+};
+
+/// Address of the hardware DWT registers
+constexpr intptr_t dwt_address = 0xE0001000UL;
+
+/// Address of the Cortex M CoreDebug module
+constexpr intptr_t core_debug_address = 0xE000EDF0UL;
+
+/// Address of the Cortex M SysTick module
+constexpr intptr_t systick_address = 0xE000E010UL;
+
+/// Number of QEMU instructions per SysTick tick. mps2-an386 clocks SysTick
+/// with the 25MHz core clock (40ns) and `-icount shift=0` retires one
+/// instruction per 1ns of virtual time.
+constexpr std::uint32_t qemu_instructions_per_tick = 40;
+
+// NOLINTNEXTLINE
+inline auto* dwt = reinterpret_cast<dwt_register_t*>(dwt_address);
+
+// NOLINTNEXTLINE
+inline auto* core =
+  reinterpret_cast<core_debug_registers_t*>(core_debug_address);
+
+// NOLINTNEXTLINE
+inline auto* systick = reinterpret_cast<systick_register_t*>(systick_address);
+
+inline void
+dwt_counter_enable()
+{
+#if BENCHMARK_HOST
+  // Nothing to enable, the host counters are always running
+#elif BENCHMARK_QEMU
+  /// Use the processor clock rather than the external reference clock
+  constexpr unsigned clock_source_processor = 1 << 2U;
+
+  /// Mask for turning on the counter.
+  constexpr unsigned enable_counter = 1 << 0;
+
+  // Count down from the largest 24-bit value and wrap around forever
+  systick->load = 0x00FF'FFFF;
+  systick->val = 0;
+  systick->ctrl = clock_source_processor | enable_counter;
+#else
+  /**
+   * @brief This bit must be set to 1 to enable use of the trace and debug
+   * blocks:
+   *
+   *   - Data Watchpoint and Trace (DWT)
+   *   - Instrumentation Trace Macrocell (ITM)
+   *   - Embedded Trace Macrocell (ETM)
+   *   - Trace Port Interface Unit (TPIU).
+   */
+  constexpr unsigned core_trace_enable = 1 << 24U;
+
+  /// Mask for turning on cycle counter.
+  constexpr unsigned enable_cycle_count = 1 << 0;
+
+  // Enable trace core
+  core->demcr = (core->demcr | core_trace_enable);
+
+  // Reset cycle count
+  dwt->cyccnt = 0;
+
+  // Start cycle count
+  dwt->ctrl = (dwt->ctrl | enable_cycle_count);
+#endif
+}
+
+inline void
+enable_flash_accelerator()
+{
+#if !BENCHMARK_QEMU && !BENCHMARK_HOST
+  // Set flash accelerator to 1 CPU cycle per instruction
+  *reinterpret_cast<std::uint32_t*>(0x400F'C000) = 0xA;
+#endif
+}
+
+inline std::uint32_t
+uptime()
+{
+#if BENCHMARK_HOST && defined(__x86_64__)
+  _mm_lfence();
+  return static_cast<std::uint32_t>(__rdtsc());
+#elif BENCHMARK_HOST
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<std::uint32_t>(now.tv_sec * 1'000'000'000LL +
+                                    now.tv_nsec);
+#elif BENCHMARK_QEMU
+  // SysTick is a 24-bit down counter. Extend it into a monotonic 32-bit value
+  // by counting wrap arounds. This only requires that uptime() is called at
+  // least once every 2^24 ticks, which every benchmark loop does.
+  static std::uint32_t upper_ticks = 0;
+  static std::uint32_t last_ticks = 0;
+  std::uint32_t ticks = 0x00FF'FFFF - systick->val;
+  if (ticks < last_ticks) {
+    upper_ticks += 0x0100'0000;
+  }
+  last_ticks = ticks;
+  return (upper_ticks + ticks) * qemu_instructions_per_tick;
+#else
+  return dwt->cyccnt;
+#endif
+}
+
+#if !BENCHMARK_HOST
+/// Lowest address of the stack region, see standard_arm.ld
+extern "C" std::uint32_t __heap_end[]; // NOLINT
+#endif
+
+/// Written over the unused stack by stack_paint()
+constexpr std::uint32_t stack_paint_pattern = 0xC0DE'57AC;
+
+inline std::uintptr_t
+stack_pointer()
+{
+#if BENCHMARK_HOST
+  return 0;
+#else
+  std::uintptr_t stack_pointer = 0;
+  asm volatile("mov %0, sp" : "=r"(stack_pointer));
+  return stack_pointer;
+#endif
+}
+
+/**
+ * @brief Fill every word below the caller's stack frame with
+ * stack_paint_pattern
+ *
+ * The writes are volatile so the loop does not become a memset() call whose
+ * own frame would sit in the painted region. Does nothing on the host.
+ */
+[[gnu::noinline]] inline void
+stack_paint()
+{
+#if !BENCHMARK_HOST
+  volatile std::uint32_t* word = __heap_end;
+  auto* end = reinterpret_cast<std::uint32_t*>(stack_pointer());
+  while (word < end) {
+    *word = stack_paint_pattern;
+    word++;
+  }
+#endif
+}
+
+/**
+ * @brief Bytes of stack below p_reference written since stack_paint()
+ *
+ * @param p_reference - stack_pointer() of the frame that made the calls
+ * @return the deepest point the calls reached, 0 on the host
+ */
+inline std::uint32_t
+stack_usage([[maybe_unused]] std::uintptr_t p_reference)
+{
+#if BENCHMARK_HOST
+  return 0;
+#else
+  const volatile std::uint32_t* word = __heap_end;
+  while (reinterpret_cast<std::uintptr_t>(word) < p_reference &&
+         *word == stack_paint_pattern) {
+    word++;
+  }
+  return p_reference - reinterpret_cast<std::uintptr_t>(word);
+#endif
+}
+
+#if BENCHMARK_QEMU
+/// ARM semihosting operation numbers
+enum class semihost_operation : int
+{
+  open = 0x01,
+  close = 0x02,
+  write = 0x05,
+  exit = 0x18,
+};
+
+inline int
+semihost_call(semihost_operation p_operation, const void* p_argument)
+{
+  register int r0 asm("r0") = static_cast<int>(p_operation);
+  register const void* r1 asm("r1") = p_argument;
+  asm volatile("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+  return r0;
+}
+#endif
+
+/**
+ * @brief Stop the benchmark
+ *
+ * On hardware this spins forever, put a breakpoint here to inspect the results.
+ * Under QEMU this exits the emulator through semihosting and on the host it
+ * exits the process.
+ */
+[[noreturn]] inline void
+benchmark_halt()
+{
+#if BENCHMARK_HOST
+  std::_Exit(EXIT_SUCCESS);
+#elif BENCHMARK_QEMU
+  /// ADP_Stopped_ApplicationExit
+  constexpr std::uintptr_t application_exit = 0x20026;
+  semihost_call(semihost_operation::exit,
+                reinterpret_cast<const void*>(application_exit));
+#endif
+  while (true) {
+    continue;
+  }
+}
+
+/**
+ * @brief Write-only CSV file on the host
+ *
+ * Does nothing on hardware, writes through semihosting under QEMU and through
+ * stdio on the host.
+ */
+class csv_file
+{
+public:
+  explicit csv_file([[maybe_unused]] std::string_view p_path)
+  {
+#if BENCHMARK_HOST
+    m_file = std::fopen(p_path.data(), "w");
+#elif BENCHMARK_QEMU
+    /// "w" in the semihosting fopen() mode table
+    constexpr std::uintptr_t write_mode = 4;
+    std::array<std::uintptr_t, 3> arguments = {
+      reinterpret_cast<std::uintptr_t>(p_path.data()),
+      write_mode,
+      p_path.size(),
+    };
+    m_handle = semihost_call(semihost_operation::open, arguments.data());
+#endif
+  }
+
+  csv_file(csv_file&) = delete;
+  csv_file& operator=(csv_file&) = delete;
+
+  csv_file& operator<<([[maybe_unused]] std::string_view p_text)
+  {
+#if BENCHMARK_HOST
+    if (m_file != nullptr) {
+      std::fwrite(p_text.data(), 1, p_text.size(), m_file);
+    }
+#elif BENCHMARK_QEMU
+    if (m_handle < 0) {
+      return *this;
+    }
+    std::array<std::uintptr_t, 3> arguments = {
+      static_cast<std::uintptr_t>(m_handle),
+      reinterpret_cast<std::uintptr_t>(p_text.data()),
+      p_text.size(),
+    };
+    semihost_call(semihost_operation::write, arguments.data());
+#endif
+    return *this;
+  }
+
+  csv_file& operator<<(std::uint64_t p_value)
+  {
+    std::array<char, 24> buffer{};
+    auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), p_value);
+    return *this << std::string_view(buffer.data(), result.ptr - buffer.data());
+  }
+
+  ~csv_file()
+  {
+#if BENCHMARK_HOST
+    if (m_file != nullptr) {
+      std::fclose(m_file);
+    }
+#elif BENCHMARK_QEMU
+    if (m_handle >= 0) {
+      semihost_call(semihost_operation::close, &m_handle);
+    }
+#endif
+  }
+
+private:
+#if BENCHMARK_HOST
+  std::FILE* m_file = nullptr;
+#endif
+  int m_handle = -1;
+};
+
+/// Deepest stack a call reached, see stack_usage()
+struct stack_depth
+{
+  std::uint32_t bytes = 0;
+};
+
+/// The host cannot paint its stack, so the column is left empty there
+inline csv_file&
+operator<<(csv_file& p_csv, [[maybe_unused]] const stack_depth& p_depth)
+{
+#if !BENCHMARK_HOST
+  p_csv << p_depth.bytes;
+#endif
+  return p_csv;
+}
+
+/// Empty for a measurement this build cannot take
+template<typename T>
+csv_file&
+operator<<(csv_file& p_csv, const std::optional<T>& p_value)
+{
+  if (p_value) {
+    p_csv << *p_value;
+  }
+  return p_csv;
+}
+
+/**
+ * @brief Export one row per group index to BENCHMARK_OUTPUT
+ *
+ * @param p_header - CSV header, the first column must be the group index
+ * @param p_columns - arrays of equal length, one per column after the index.
+ * Elements are written with `csv_file::operator<<`, so an element may expand
+ * into several columns.
+ */
+template<typename... Columns>
+void
+export_csv(std::string_view p_header, const Columns&... p_columns)
+{
+  csv_file csv(BENCHMARK_OUTPUT);
+  csv << p_header << "\n";
+  const std::size_t rows = std::min({ std::size(p_columns)... });
+  for (std::size_t row = 0; row < rows; row++) {
+    csv << static_cast<std::uint64_t>(row);
+    ((csv << "," << p_columns[row]), ...);
+    csv << "\n";
+  }
+}
@@ -0,0 +1,157 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// QEMU TCG plugin that records the address of every instruction executed
+// from the entry of __cxa_throw until the catching function runs again.
+// trace_qemu.py resolves the addresses from the ELF and passes them in:
+//
+//   -plugin libexception_trace.so,throw=<__cxa_throw>,
+//           catch_start=<start>,catch_end=<start + size>,
+//           limit=<throws>,output=<file>
+//
+// The output is little endian 32 bit addresses, each throw ends with
+// trace_end_of_throw. Only one vCPU is traced, like the mps2-an386 machine.
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+static const uint32_t trace_end_of_throw = 0xFFFFFFFF;
+
+static uint64_t throw_address = 0;
+static uint64_t catch_start = 0;
+static uint64_t catch_end = 0;
+static uint64_t throw_limit = UINT64_MAX;
+static uint64_t throw_count = 0;
+static bool tracing = false;
+static FILE* output = NULL;
+
+static void
+write_address(uint32_t p_address)
+{
+  uint8_t bytes[4] = { p_address & 0xFF,
+                       (p_address >> 8) & 0xFF,
+                       (p_address >> 16) & 0xFF,
+                       (p_address >> 24) & 0xFF };
+  fwrite(bytes, sizeof(bytes), 1, output);
+}
+
+static void
+vcpu_insn_exec(unsigned int p_vcpu_index, void* p_user_data)
+{
+  (void)p_vcpu_index;
+  uint64_t address = (uint64_t)(uintptr_t)p_user_data;
+
+  if (!tracing) {
+    if (address == throw_address && throw_count < throw_limit) {
+      tracing = true;
+      write_address((uint32_t)address);
+    }
+    return;
+  }
+
+  if (catch_start <= address && address < catch_end) {
+    // Back in the function with the handler, the throw is over
+    tracing = false;
+    throw_count++;
+    write_address(trace_end_of_throw);
+    return;
+  }
+  write_address((uint32_t)address);
+}
+
+static void
+vcpu_tb_trans(qemu_plugin_id_t p_id, struct qemu_plugin_tb* p_tb)
+{
+  (void)p_id;
+  size_t count = qemu_plugin_tb_n_insns(p_tb);
+  for (size_t index = 0; index < count; index++) {
+    struct qemu_plugin_insn* insn = qemu_plugin_tb_get_insn(p_tb, index);
+    uint64_t address = qemu_plugin_insn_vaddr(insn);
+    qemu_plugin_register_vcpu_insn_exec_cb(insn,
+                                           vcpu_insn_exec,
+                                           QEMU_PLUGIN_CB_NO_REGS,
+                                           (void*)(uintptr_t)address);
+  }
+}
+
+static void
+plugin_exit(qemu_plugin_id_t p_id, void* p_user_data)
+{
+  (void)p_id;
+  (void)p_user_data;
+  if (tracing) {
+    // The image halted inside a throw, keep what was recorded
+    write_address(trace_end_of_throw);
+  }
+  fclose(output);
+}
+
+static bool
+parse_address(const char* p_argument, const char* p_name, uint64_t* p_value)
+{
+  size_t length = strlen(p_name);
+  if (strncmp(p_argument, p_name, length) != 0 || p_argument[length] != '=') {
+    return false;
+  }
+  *p_value = strtoull(p_argument + length + 1, NULL, 0);
+  return true;
+}
+
+QEMU_PLUGIN_EXPORT int
+qemu_plugin_install(qemu_plugin_id_t p_id,
+                    const qemu_info_t* p_info,
+                    int p_argc,
+                    char** p_argv)
+{
+  (void)p_info;
+  const char* path = "exception_trace.bin";
+  for (int index = 0; index < p_argc; index++) {
+    const char* argument = p_argv[index];
+    if (parse_address(argument, "throw", &throw_address) ||
+        parse_address(argument, "catch_start", &catch_start) ||
+        parse_address(argument, "catch_end", &catch_end) ||
+        parse_address(argument, "limit", &throw_limit)) {
+      continue;
+    }
+    if (strncmp(argument, "output=", 7) == 0) {
+      path = argument + 7;
+      continue;
+    }
+    fprintf(stderr, "exception_trace: unknown argument %s\n", argument);
+    return -1;
+  }
+  if (throw_address == 0 || catch_start >= catch_end) {
+    fprintf(stderr, "exception_trace: throw, catch_start and catch_end are "
+                    "required\n");
+    return -1;
+  }
+
+  output = fopen(path, "wb");
+  if (output == NULL) {
+    perror(path);
+    return -1;
+  }
+
+  qemu_plugin_register_vcpu_tb_trans_cb(p_id, vcpu_tb_trans);
+  qemu_plugin_register_atexit_cb(p_id, plugin_exit, NULL);
+  return 0;
+}
@@ -4,144 +4,29 @@
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
-#include <limits>
 #include <span>
 #include <string_view>
 
+#include "platform.hpp"
+#include "statistics.hpp"
+
 volatile std::int32_t side_effect = 0;
 std::uint32_t start_cycles = 0;
 std::uint32_t end_cycles = 0;
 
-/// Structure type to access the Data Watch point and Trace Register (DWT).
-struct dwt_register_t
-{
-  /// Offset: 0x000 (R/W)  Control Register
-  volatile uint32_t ctrl;
-  /// Offset: 0x004 (R/W)  Cycle Count Register
-  volatile uint32_t cyccnt;
-  /// Offset: 0x008 (R/W)  CPI Count Register
-  volatile uint32_t cpicnt;
-  /// Offset: 0x00C (R/W)  Exception Overhead Count Register
-  volatile uint32_t exccnt;
-  /// Offset: 0x010 (R/W)  Sleep Count Register
-  volatile uint32_t sleepcnt;
-  /// Offset: 0x014 (R/W)  LSU Count Register
-  volatile uint32_t lsucnt;
-  /// Offset: 0x018 (R/W)  Folded-instruction Count Register
-  volatile uint32_t foldcnt;
-  /// Offset: 0x01C (R/ )  Program Counter Sample Register
-  volatile const uint32_t pcsr;
-  /// Offset: 0x020 (R/W)  Comparator Register 0
-  volatile uint32_t comp0;
-  /// Offset: 0x024 (R/W)  Mask Register 0
-  volatile uint32_t mask0;
-  /// Offset: 0x028 (R/W)  Function Register 0
-  volatile uint32_t function0;
-  /// Reserved 0
-  std::array<uint32_t, 1> reserved0;
-  /// Offset: 0x030 (R/W)  Comparator Register 1
-  volatile uint32_t comp1;
-  /// Offset: 0x034 (R/W)  Mask Register 1
-  volatile uint32_t mask1;
-  /// Offset: 0x038 (R/W)  Function Register 1
-  volatile uint32_t function1;
-  /// Reserved 1
-  std::array<uint32_t, 1> reserved1;
-  /// Offset: 0x040 (R/W)  Comparator Register 2
-  volatile uint32_t comp2;
-  /// Offset: 0x044 (R/W)  Mask Register 2
-  volatile uint32_t mask2;
-  /// Offset: 0x048 (R/W)  Function Register 2
-  volatile uint32_t function2;
-  /// Reserved 2
-  std::array<uint32_t, 1> reserved2;
-  /// Offset: 0x050 (R/W)  Comparator Register 3
-  volatile uint32_t comp3;
-  /// Offset: 0x054 (R/W)  Mask Register 3
-  volatile uint32_t mask3;
-  /// Offset: 0x058 (R/W)  Function Register 3
-  volatile uint32_t function3;
-};
-
-/// Structure type to access the Core Debug Register (CoreDebug)
-struct core_debug_registers_t
-{
-  /// Offset: 0x000 (R/W)  Debug Halting Control and Status Register
-  volatile uint32_t dhcsr;
-  /// Offset: 0x004 ( /W)  Debug Core Register Selector Register
-  volatile uint32_t dcrsr;
-  /// Offset: 0x008 (R/W)  Debug Core Register Data Register
-  volatile uint32_t dcrdr;
-  /// Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register
-  volatile uint32_t demcr;
-};
-
-/// Address of the hardware DWT registers
-constexpr intptr_t dwt_address = 0xE0001000UL;
-
-/// Address of the Cortex M CoreDebug module
-constexpr intptr_t core_debug_address = 0xE000EDF0UL;
-
-// NOLINTNEXTLINE
-auto* dwt = reinterpret_cast<dwt_register_t*>(dwt_address);
-
-// NOLINTNEXTLINE
-auto* core = reinterpret_cast<core_debug_registers_t*>(core_debug_address);
-
-void
-dwt_counter_enable()
-{
-  /**
-   * @brief This bit must be set to 1 to enable use of the trace and debug
-   * blocks:
-   *
-   *   - Data Watchpoint and Trace (DWT)
-   *   - Instrumentation Trace Macrocell (ITM)
-   *   - Embedded Trace Macrocell (ETM)
-   *   - Trace Port Interface Unit (TPIU).
-   */
-  constexpr unsigned core_trace_enable = 1 << 24U;
-
-  /// Mask for turning on cycle counter.
-  constexpr unsigned enable_cycle_count = 1 << 0;
-
-  // Enable trace core
-  core->demcr = (core->demcr | core_trace_enable);
-
-  // Reset cycle count
-  dwt->cyccnt = 0;
-
-  // Start cycle count
-  dwt->ctrl = (dwt->ctrl | enable_cycle_count);
-}
-
-std::uint32_t
-uptime()
-{
-  return dwt->cyccnt;
-}
-
 #include <tl/expected.hpp>
 struct my_error_t
 {
   std::array<std::uint8_t, 4> data;
 };
 
-[[noreturn]] void
-halt()
-{
-  while (true) {
-    continue;
-  }
-}
 tl::expected<int, my_error_t>
 start();
 int
 main()
 {
   dwt_counter_enable();
-  // Set flash accelerator to 1 CPU cycle per instruction
-  *reinterpret_cast<std::uint32_t*>(0x400F'C000) = 0xA;
+  enable_flash_accelerator();
   volatile int return_code = 0;
   auto result = start();
   if (!result) {
@@ -149,11 +34,15 @@ main()
   } else {
     return_code = result.value();
   }
-  halt();
+  benchmark_halt();
   return return_code;
 }
 
+constexpr std::size_t trial_count = 100;
 std::array<std::uint64_t, 25> cycle_map{};
+std::array<cycle_statistics, 25> cycle_stats{};
+std::array<std::array<std::uint32_t, trial_count>, 25> trial_cycles{};
+std::array<std::uint64_t, 25> stack_map{};
 std::array<std::uint64_t, 25> happy_cycle_map{};
 
 tl::expected<int, my_error_t>
@@ -223,25 +112,62 @@ tl::expected<int, my_error_t>
 start()
 {
   cycle_map.fill(0);
-  happy_cycle_map.fill(std::numeric_limits<std::int32_t>::max());
-  std::uint32_t index = 0;
-  for (auto& funct : functions) {
-    start_cycles = uptime();
-    if (auto result = funct(); !result) {
-      end_cycles = uptime();
-      cycle_map[index++] = end_cycles - start_cycles;
+  measure_call_latency();
+
+  // Round robin over the groups so every trial sees the same sequence of
+  // errors as a single pass would.
+  for (std::size_t trial = 0; trial < trial_count; trial++) {
+    std::uint32_t index = 0;
+    for (auto& funct : functions) {
+      start_cycles = uptime();
+      if (auto result = funct(); !result) {
+        end_cycles = uptime();
+        trial_cycles[index][trial] = elapsed_cycles(start_cycles, end_cycles);
+      }
+      index++;
+    }
+  }
+
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    cycle_stats[index] = summarize(trial_cycles[index]);
+    cycle_map[index] = cycle_stats[index].median;
+  }
+
+  // Deepest stack each error propagation reaches
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    stack_paint();
+    auto stack_reference = stack_pointer();
+    if (auto result = functions[index](); !result) {
+      side_effect = side_effect + result.error().data[0];
     }
+    stack_map[index] = stack_usage(stack_reference);
   }
-  index = 0;
-  for (auto& funct : functions) {
-    // should prevent result from being unexpected
-    side_effect = -1'000'000'000;
-    start_cycles = uptime();
-    if (auto result = funct(); result) {
-      end_cycles = uptime();
-      happy_cycle_map[index++] = end_cycles - start_cycles;
+
+  // Round robin over the groups so every trial sees the same sequence of
+  // calls as a single pass would.
+  for (std::size_t trial = 0; trial < trial_count; trial++) {
+    std::uint32_t index = 0;
+    for (auto& funct : functions) {
+      side_effect = -1'000'000'000;
+      start_cycles = uptime();
+      if (auto result = funct(); result) {
+        end_cycles = uptime();
+        trial_cycles[index][trial] = elapsed_cycles(start_cycles, end_cycles);
+      }
+      index++;
     }
   }
+
+  for (std::size_t index = 0; index < functions.size(); index++) {
+    happy_cycle_map[index] = summarize(trial_cycles[index]).median;
+  }
+
+  export_csv(
+    "group_index,cycles,stack_bytes,happy_cycles,min,median,mean,max,p99",
+    cycle_map,
+    stack_map,
+    happy_cycle_map,
+    cycle_stats);
   return side_effect;
 }
 
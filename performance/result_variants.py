@@ -0,0 +1,143 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Compares the result benchmark across the result types generate.py emits:
+result (tl::expected), result_std (std::expected) and result_packed
+(packed_result.hpp, returned in r0/r1).
+
+    cmake --build build/MinSizeRel --target run_qemu
+    python3 result_variants.py --results build/MinSizeRel/results.csv \\
+        --elf-dir build/MinSizeRel
+
+For every variant it reports:
+
+- cycles_per_frame: slope of `cycles` over the call depth of the groups,
+  fitted for each destructor ratio and averaged, like `comparisons.md`
+- happy_cycles_per_frame: the same for `happy_cycles`
+- bytes_per_frame: size of the funct_group functions over their number
+- bytes_per_check: size of the funct_group functions over the number of
+  error checks in them, counted in the generated source
+"""
+
+import argparse
+import collections
+import csv
+import re
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+from cycle_model import linear_fit
+from elf_reader import elf_file
+
+VARIANTS = ["result", "result_std", "result_packed"]
+FUNCTION_DEFINITION = re.compile(r"funct_group\d+_\d+\(\)\s*\{")
+# `!result)`, `!instance_0)` and `!scoped_result)` of each propagation
+ERROR_CHECK = re.compile(r"!(result|instance_\d+|scoped_result)\)")
+
+
+def cycles_per_frame(rows: List[Dict[str, str]], column: str) -> \
+        Optional[float]:
+    by_ratio: Dict[str, List[Tuple[float, float]]] = \
+        collections.defaultdict(list)
+    for row in rows:
+        if row.get(column):
+            by_ratio[row["ratio"]].append((float(row["depth"]),
+                                           float(row[column])))
+    slopes = [linear_fit(points)[0] for points in by_ratio.values()
+              if len(points) >= 2]
+    if not slopes:
+        return None
+    return sum(slopes) / len(slopes)
+
+
+def function_bytes(elf: Path) -> Tuple[int, int]:
+    """Total size and number of the funct_group functions"""
+    functions = [function for function in elf_file(elf).functions()
+                 if "funct_group" in function.name]
+    return sum(function.size for function in functions), len(functions)
+
+
+def error_checks(source: Path) -> int:
+    """Error checks in the funct_group functions of a generated source"""
+    text = source.read_text()
+    first = FUNCTION_DEFINITION.search(text)
+    if first is None:
+        return 0
+    # The classes and start() come before the first function of a group
+    return len(ERROR_CHECK.findall(text, first.start()))
+
+
+def find_elf(elf_dir: Path, name: str) -> Optional[Path]:
+    for suffix in (".elf", ".qemu.elf"):
+        path = elf_dir / f"{name}{suffix}"
+        if path.exists():
+            return path
+    return None
+
+
+def format_value(value: Optional[float]) -> str:
+    return "" if value is None else f"{value:.1f}"
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compare tl::expected, std::expected and packed_result")
+    parser.add_argument("--results", type=Path,
+                        help="results.csv written by run_qemu.py")
+    parser.add_argument("--elf-dir", type=Path,
+                        help="Build directory with result*.elf")
+    parser.add_argument("--source-dir", type=Path, default=Path("."),
+                        help="Directory of the sources written by "
+                             "generate.py")
+    parser.add_argument("-o", "--output", type=Path,
+                        help="CSV to write, stdout by default")
+    args = parser.parse_args()
+
+    rows: List[Dict[str, str]] = []
+    if args.results:
+        with args.results.open(newline="") as file:
+            rows = list(csv.DictReader(file))
+
+    output = args.output.open("w", newline="") if args.output else sys.stdout
+    writer = csv.writer(output)
+    writer.writerow(["variant", "cycles_per_frame", "happy_cycles_per_frame",
+                     "bytes_per_frame", "bytes_per_check"])
+    for variant in VARIANTS:
+        source = args.source_dir / f"{variant}.cpp"
+        elf = find_elf(args.elf_dir, variant) if args.elf_dir else None
+        if not source.exists() and elf is None:
+            continue
+
+        bytes_per_frame = bytes_per_check = None
+        if elf is not None:
+            size, count = function_bytes(elf)
+            if count:
+                bytes_per_frame = size / count
+            checks = error_checks(source) if source.exists() else 0
+            if checks:
+                bytes_per_check = size / checks
+
+        writer.writerow([
+            variant,
+            format_value(cycles_per_frame(rows, f"{variant}.cycles")),
+            format_value(cycles_per_frame(rows, f"{variant}.happy_cycles")),
+            format_value(bytes_per_frame),
+            format_value(bytes_per_check)])
+
+    if args.output:
+        output.close()
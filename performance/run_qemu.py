@@ -0,0 +1,123 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import csv
+import subprocess
+import sys
+from pathlib import Path
+from typing import Dict, List
+
+
+def qemu_command(qemu: str, elf: Path) -> List[str]:
+    return [
+        qemu,
+        "-machine", "mps2-an386",
+        "-nographic",
+        "-monitor", "none",
+        "-semihosting-config", "enable=on,target=native",
+        # One instruction per 1ns of virtual time so that SysTick readings are
+        # deterministic and independent of the host machine.
+        "-icount", "shift=0,align=off,sleep=off",
+        "-kernel", str(elf.resolve()),
+    ]
+
+
+def benchmark_name(elf: Path) -> str:
+    # except.qemu.elf -> except
+    return elf.name.split(".")[0]
+
+
+def run(qemu: str, elf: Path, output_dir: Path, timeout: int) -> Path:
+    name = benchmark_name(elf)
+    csv_path = output_dir / f"{name}.csv"
+    csv_path.unlink(missing_ok=True)
+
+    subprocess.run(qemu_command(qemu, elf), cwd=output_dir, timeout=timeout,
+                   check=True, stdin=subprocess.DEVNULL)
+
+    if not csv_path.exists():
+        raise RuntimeError(f"{elf} exited without writing {csv_path.name}")
+
+    return csv_path
+
+
+def merge(info: Path, results: Dict[str, Path], output):
+    """Join every benchmark CSV onto info.csv using the group_index column"""
+    with info.open() as info_file:
+        rows = list(csv.DictReader(info_file))
+
+    fieldnames = list(rows[0].keys())
+    by_group = {row["group_index"]: row for row in rows}
+
+    for name, path in results.items():
+        with path.open() as result_file:
+            for result_row in csv.DictReader(result_file):
+                group = by_group.get(result_row["group_index"])
+                if group is None:
+                    continue
+                for column, value in result_row.items():
+                    if column == "group_index":
+                        continue
+                    key = f"{name}.{column}"
+                    if key not in fieldnames:
+                        fieldnames.append(key)
+                    group[key] = value
+
+    writer = csv.DictWriter(output, fieldnames=fieldnames, restval="")
+    writer.writeheader()
+    writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Run the performance benchmarks under QEMU and collect "
+                    "their cycle maps into a single CSV")
+    parser.add_argument("elfs", nargs="+", type=Path,
+                        help="Benchmark ELF files built with BENCHMARK_QEMU=1")
+    parser.add_argument("-i", "--info", type=Path, default=Path("info.csv"),
+                        help="info.csv produced by generate.py")
+    parser.add_argument("-o", "--output", type=Path,
+                        help="Merged CSV output file, defaults to stdout")
+    parser.add_argument("-d", "--output-dir", type=Path, default=Path("."),
+                        help="Directory where each benchmark writes its CSV")
+    parser.add_argument("-q", "--qemu", default="qemu-system-arm",
+                        help="Path to qemu-system-arm")
+    parser.add_argument("-t", "--timeout", type=int, default=120,
+                        help="Seconds before a benchmark is considered hung")
+    parser.add_argument("-n", "--no-merge", action="store_true",
+                        help="Only run the benchmarks and keep each CSV, for "
+                             "benchmarks not keyed by the groups of info.csv")
+    args = parser.parse_args()
+
+    args.output_dir.mkdir(parents=True, exist_ok=True)
+
+    results = {}
+    for elf in args.elfs:
+        print(f"Running {elf} ...", file=sys.stderr)
+        results[benchmark_name(elf)] = run(args.qemu, elf, args.output_dir,
+                                           args.timeout)
+
+    if args.no_merge:
+        for path in results.values():
+            print(path)
+        sys.exit(0)
+
+    if args.output:
+        with args.output.open("w", newline="") as output:
+            merge(args.info, results, output)
+    else:
+        merge(args.info, results, sys.stdout)
@@ -0,0 +1,99 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief One cache line that tasks and interrupts read and write at once
+ *
+ * ARMv7-M has no 64 bit LDREXD/STREXD, so a line of two words cannot be
+ * swapped in one go. The line is kept as 32 bit atomic words behind a
+ * sequence number that is odd while a writer is in it. A reader that sees
+ * the number odd or changed got a torn copy and treats the line as a miss.
+ * Writers do not wait for each other either: a store into a line another
+ * writer holds is dropped, which a cache can afford.
+ *
+ * Readers cost two extra loads and a DMB, writers a LDREX/STREX pair and two
+ * DMBs.
+ *
+ * @tparam T - trivially copyable contents of the line
+ */
+template<typename T>
+class seqlock_line
+{
+public:
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  /// @return false if a writer was in the line, p_value is left untouched
+  [[gnu::always_inline]] bool load(T& p_value) const
+  {
+    auto before = m_sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      return false;
+    }
+    std::array<std::uint32_t, word_count> copy;
+    for (std::size_t index = 0; index < word_count; index++) {
+      copy[index] = m_words[index].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_sequence.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    std::memcpy(static_cast<void*>(&p_value), copy.data(), sizeof(T));
+    return true;
+  }
+
+  /// @return false if another writer holds the line and p_value was dropped
+  [[gnu::always_inline]] bool store(const T& p_value)
+  {
+    auto sequence = m_sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) ||
+        !m_sequence.compare_exchange_strong(
+          sequence, sequence + 1, std::memory_order_relaxed)) {
+      return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::array<std::uint32_t, word_count> copy{};
+    std::memcpy(copy.data(), &p_value, sizeof(T));
+    for (std::size_t index = 0; index < word_count; index++) {
+      m_words[index].store(copy[index], std::memory_order_relaxed);
+    }
+    m_sequence.store(sequence + 2, std::memory_order_release);
+    return true;
+  }
+
+  /// Zeroes the line, only while no task uses it
+  void reset()
+  {
+    for (auto& word : m_words) {
+      word.store(0, std::memory_order_relaxed);
+    }
+    m_sequence.store(0, std::memory_order_release);
+  }
+
+private:
+  static constexpr std::size_t word_count =
+    (sizeof(T) + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t);
+
+  std::atomic<std::uint32_t> m_sequence{ 0 };
+  std::array<std::atomic<std::uint32_t>, word_count> m_words{};
+};
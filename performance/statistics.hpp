@@ -0,0 +1,105 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "platform.hpp"
+
+/// Cycles spent calling uptime() back to back. Subtracted from every sample.
+inline std::uint32_t call_latency = 0;
+
+inline void
+measure_call_latency()
+{
+  auto call_latency_test_start = uptime();
+  auto call_latency_test_end = uptime();
+  call_latency = call_latency_test_end - call_latency_test_start;
+}
+
+/**
+ * @brief Cycles between two uptime() readings without the timer overhead
+ */
+inline std::uint32_t
+elapsed_cycles(std::uint32_t p_start, std::uint32_t p_end)
+{
+  std::uint32_t elapsed = p_end - p_start;
+  if (elapsed < call_latency) {
+    return 0;
+  }
+  return elapsed - call_latency;
+}
+
+/// Fewer samples than this make the nearest rank p99 the max
+constexpr std::size_t p99_min_samples = 100;
+
+struct cycle_statistics
+{
+  std::uint32_t min = 0;
+  std::uint32_t median = 0;
+  std::uint32_t mean = 0;
+  std::uint32_t max = 0;
+  /// 0 and written as an empty column below p99_min_samples
+  std::uint32_t p99 = 0;
+  std::size_t samples = 0;
+};
+
+/**
+ * @brief Summarize a set of trials
+ *
+ * @param p_samples - cycle counts of each trial, sorted in place
+ * @return cycle_statistics - all zeros if p_samples is empty
+ */
+inline cycle_statistics
+summarize(std::span<std::uint32_t> p_samples)
+{
+  if (p_samples.empty()) {
+    return {};
+  }
+
+  std::sort(p_samples.begin(), p_samples.end());
+
+  std::uint64_t sum = 0;
+  for (auto sample : p_samples) {
+    sum += sample;
+  }
+
+  const std::size_t count = p_samples.size();
+  // Nearest rank: the smallest sample that is >= 99% of all samples
+  const std::size_t p99_rank = (count * 99 + 99) / 100;
+
+  return {
+    .min = p_samples.front(),
+    .median = p_samples[count / 2],
+    .mean = static_cast<std::uint32_t>(sum / count),
+    .max = p_samples.back(),
+    .p99 = count >= p99_min_samples ? p_samples[p99_rank - 1] : 0,
+    .samples = count,
+  };
+}
+
+inline csv_file&
+operator<<(csv_file& p_csv, const cycle_statistics& p_statistics)
+{
+  p_csv << p_statistics.min << "," << p_statistics.median << ","
+        << p_statistics.mean << "," << p_statistics.max << ",";
+  if (p_statistics.samples >= p99_min_samples) {
+    p_csv << p_statistics.p99;
+  }
+  return p_csv;
+}
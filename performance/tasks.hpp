@@ -0,0 +1,190 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "exception_globals.hpp"
+#include "platform.hpp"
+
+#if BENCHMARK_HOST
+#include <thread>
+#include <vector>
+#endif
+
+// Tasks for the concurrent throw benchmark.
+//
+// On the host every task is a std::thread and the kernel preempts them, so
+// task_yield() does nothing. On bare metal and QEMU the tasks are
+// cooperative: each one has its own stack and cxa_eh_globals_layout, and
+// task_yield() switches to the next task that has not finished. A yield in
+// a destructor run by a cleanup leaves the throw half way and lets the next
+// task throw, like a preemptive RTOS would. run_tasks() points
+// exception_globals_hook at the current task while they run.
+
+/// Bytes of stack of each bare metal task, throws included
+#if !defined(TASK_STACK_SIZE)
+#define TASK_STACK_SIZE 4096
+#endif
+
+constexpr std::size_t max_tasks = 8;
+
+/// Body of a task, called with the index of the task
+using task_function = void(std::size_t);
+
+#if BENCHMARK_HOST
+inline void
+task_yield()
+{
+}
+
+/// Runs p_count tasks of p_body at once and returns once all finished
+inline void
+run_tasks(std::size_t p_count, task_function* p_body)
+{
+  std::vector<std::thread> threads;
+  for (std::size_t index = 0; index < p_count; index++) {
+    threads.emplace_back(p_body, index);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+#else
+struct task_control
+{
+  std::uint32_t* stack_pointer;
+  cxa_eh_globals_layout exception_globals;
+  bool done;
+  alignas(8) std::array<std::uint32_t, TASK_STACK_SIZE / 4> stack;
+};
+
+inline std::array<task_control, max_tasks> tasks{};
+inline std::size_t task_count = 0;
+inline std::size_t current_task = 0;
+inline std::uint32_t* scheduler_stack_pointer = nullptr;
+inline task_function* task_body = nullptr;
+
+/// Words task_switch() pushes: s16-s31 with an FPU, r4-r11 and lr
+constexpr std::size_t task_frame_words =
+#if defined(__ARM_FP)
+  16 +
+#endif
+  9;
+
+extern "C"
+{
+  /**
+   * @brief Pushes the callee saved registers, stores the stack pointer to
+   * p_save and pops the registers saved on p_next
+   */
+  [[gnu::naked, gnu::noinline]] inline void task_switch(
+    [[maybe_unused]] std::uint32_t** p_save,
+    [[maybe_unused]] std::uint32_t* p_next)
+  {
+    asm("push {r4-r11, lr}\n"
+#if defined(__ARM_FP)
+        "vpush {s16-s31}\n"
+#endif
+        "str sp, [r0]\n"
+        "mov sp, r1\n"
+#if defined(__ARM_FP)
+        "vpop {s16-s31}\n"
+#endif
+        "pop {r4-r11, pc}\n");
+  }
+}
+
+/// Next task after p_task that has not finished, task_count if none
+inline std::size_t
+next_task(std::size_t p_task)
+{
+  for (std::size_t step = 1; step <= task_count; step++) {
+    auto candidate = (p_task + step) % task_count;
+    if (!tasks[candidate].done) {
+      return candidate;
+    }
+  }
+  return task_count;
+}
+
+inline cxa_eh_globals_layout*
+task_exception_globals()
+{
+  return &tasks[current_task].exception_globals;
+}
+
+inline void
+task_yield()
+{
+  if (task_body == nullptr) {
+    return;
+  }
+  auto previous = current_task;
+  auto next = next_task(previous);
+  if (next == previous) {
+    return;
+  }
+  current_task = next;
+  task_switch(&tasks[previous].stack_pointer, tasks[next].stack_pointer);
+}
+
+/// First function on the stack of every task, nothing may unwind past it
+[[noreturn]] inline void
+task_entry() noexcept
+{
+  task_body(current_task);
+  tasks[current_task].done = true;
+
+  std::uint32_t* finished = nullptr;
+  auto next = next_task(current_task);
+  if (next == task_count) {
+    task_switch(&finished, scheduler_stack_pointer);
+  } else {
+    current_task = next;
+    task_switch(&finished, tasks[next].stack_pointer);
+  }
+  __builtin_unreachable();
+}
+
+/// Runs p_count tasks of p_body at once and returns once all finished
+inline void
+run_tasks(std::size_t p_count, task_function* p_body)
+{
+  task_count = std::min(p_count, max_tasks);
+  for (std::size_t index = 0; index < task_count; index++) {
+    auto& task = tasks[index];
+    task.done = false;
+    task.exception_globals = {};
+    // task_switch() pops this frame and returns into task_entry()
+    task.stack_pointer =
+      task.stack.data() + task.stack.size() - task_frame_words;
+    std::fill_n(task.stack_pointer, task_frame_words, 0);
+    task.stack_pointer[task_frame_words - 1] =
+      reinterpret_cast<std::uint32_t>(&task_entry);
+  }
+
+  auto* previous_hook = exception_globals_hook;
+  exception_globals_hook = task_exception_globals;
+  task_body = p_body;
+  current_task = 0;
+  task_switch(&scheduler_stack_pointer, tasks[0].stack_pointer);
+  task_body = nullptr;
+  exception_globals_hook = previous_hook;
+}
+#endif
@@ -0,0 +1,327 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Summarizes and compares `step,function,address` instruction traces, such as
+the machine_code_steps*.csv files and the output of trace_qemu.py.
+
+    python3 trace_profile.py functions machine_code_steps_v2.csv
+    python3 trace_profile.py throws machine_code_steps_v2.csv
+    python3 trace_profile.py collapse machine_code_steps_v2.csv > v2.folded
+    python3 trace_profile.py diff machine_code_steps_v2.csv \\
+        machine_code_steps_optimized_v6.csv --per-throw
+
+The traces only hold the function of each instruction, so the call stack is
+rebuilt from the changes of function: moving to a function that is already
+on the stack is a return to it, anything else is a call. Tail calls and
+branches between functions therefore look like calls, which only moves their
+instructions deeper into the inclusive counts of their callers.
+
+A throw starts when `__cxa_allocate_exception` or `__cxa_throw` is entered
+after the previous throw has installed its landing pad with
+`restore_core_regs`. Each instruction is put in the category of the innermost
+function on its stack that has one, see `CATEGORIES`.
+"""
+
+import argparse
+import collections
+import csv
+import sys
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Counter, Dict, List, Optional
+
+THROW_START = ("__cxa_allocate_exception", "__wrap___cxa_allocate_exception",
+               "__cxa_throw")
+LANDING_PAD_INSTALL = "restore_core_regs"
+
+# Category of every function that has one, matched on the name up to the
+# first "(" so that truncated or full signatures both match.
+CATEGORIES: Dict[str, str] = {
+    "__cxa_allocate_exception": "allocation",
+    "__wrap___cxa_allocate_exception": "allocation",
+    "__cxa_free_exception": "allocation",
+    "malloc": "allocation",
+    "free": "allocation",
+
+    "get_eit_entry": "search_EIT_table",
+    "search_EIT_table": "search_EIT_table",
+    "selfrel_offset31": "search_EIT_table",
+    "is_trivial_function": "search_EIT_table",
+
+    "__gnu_unwind_frame": "unwind execute",
+    "__gnu_unwind_execute": "unwind execute",
+    "next_unwind_byte": "unwind execute",
+    "_Unwind_VRS_Pop": "unwind execute",
+    "restore_core_regs": "unwind execute",
+    "restore_non_core_regs": "unwind execute",
+
+    "__gxx_personality_v0": "personality",
+    "__aeabi_unwind_cpp_pr0": "personality",
+    "__aeabi_unwind_cpp_pr1": "personality",
+    "__aeabi_unwind_cpp_pr2": "personality",
+    "__gnu_unwind_pr_common": "personality",
+    "__gnu_unwind_get_pr_addr": "personality",
+
+    "__cxa_begin_cleanup": "cleanup",
+    "__cxa_end_cleanup": "cleanup",
+    "__gnu_end_cleanup": "cleanup",
+    "_Unwind_Resume": "cleanup",
+    "__gnu_Unwind_Resume": "cleanup",
+
+    "__cxa_begin_catch": "catch",
+    "__cxa_end_catch": "catch",
+    "__gxx_exception_cleanup": "catch",
+}
+CATEGORY_NAMES = ["allocation", "search_EIT_table", "unwind execute",
+                  "personality", "cleanup", "catch", "other"]
+
+
+def category_of(function: str) -> Optional[str]:
+    name = function.split("(")[0]
+    if name in CATEGORIES:
+        return CATEGORIES[name]
+    # Destructors run by cleanup landing pads
+    if "::~" in name:
+        return "cleanup"
+    return None
+
+
+@dataclass
+class throw_profile:
+    first_step: int
+    instructions: int = 0
+    complete: bool = False
+    raised: bool = False
+    installed: bool = False
+    exclusive: Counter[str] = field(default_factory=collections.Counter)
+    inclusive: Counter[str] = field(default_factory=collections.Counter)
+    categories: Counter[str] = field(default_factory=collections.Counter)
+
+
+@dataclass
+class trace_profile:
+    stacks: Counter[str] = field(default_factory=collections.Counter)
+    throws: List[throw_profile] = field(default_factory=list)
+
+    @property
+    def instructions(self) -> int:
+        return sum(throw.instructions for throw in self.throws)
+
+    def complete_throws(self) -> List[throw_profile]:
+        return [throw for throw in self.throws if throw.complete]
+
+    def total(self, counts: str, throws: List[throw_profile]) -> Counter[str]:
+        """Sum of the `counts` counter of every throw of `throws`"""
+        result: Counter[str] = collections.Counter()
+        for throw in throws:
+            result.update(getattr(throw, counts))
+        return result
+
+
+def read_rows(path: Path):
+    """Yields (step, function, address) of every row of a trace"""
+    with path.open(newline="", encoding="utf-8", errors="replace") as file:
+        reader = csv.reader(file)
+        next(reader, None)
+        for row in reader:
+            if len(row) < 3:
+                continue
+            # gdb_control.py did not quote names with commas in them
+            yield int(row[0]), ",".join(row[1:-1]), int(row[-1], 16)
+
+
+def read_functions(path: Path):
+    """Yields (step, function) of every row of a trace"""
+    for step, function, _ in read_rows(path):
+        yield step, function
+
+
+def profile(path: Path) -> trace_profile:
+    result = trace_profile()
+    stack: List[str] = []
+    throw: Optional[throw_profile] = None
+    previous = None
+
+    for step, function in read_functions(path):
+        if function != previous:
+            if function in THROW_START and (throw is None or
+                                            throw.installed):
+                if throw is not None:
+                    throw.complete = True
+                throw = throw_profile(first_step=step)
+                result.throws.append(throw)
+                stack = [function]
+            elif function in THROW_START and not throw.raised:
+                # Allocating and raising are both called by the thrower
+                stack = [function]
+            elif function in stack:
+                del stack[stack.index(function) + 1:]
+            else:
+                stack.append(function)
+            previous = function
+
+        if throw is None:
+            # The trace started inside a throw
+            throw = throw_profile(first_step=step)
+            result.throws.append(throw)
+        if function == "__cxa_throw":
+            throw.raised = True
+        if function == LANDING_PAD_INSTALL:
+            throw.installed = True
+        if category_of(function) == "catch":
+            throw.complete = True
+
+        throw.exclusive[function] += 1
+        for name in set(stack):
+            throw.inclusive[name] += 1
+        result.stacks[";".join(stack)] += 1
+
+        category = next((category_of(name) for name in reversed(stack)
+                         if category_of(name)), "other")
+        throw.instructions += 1
+        throw.categories[category] += 1
+
+    return result
+
+
+def write_functions(result: trace_profile, output):
+    writer = csv.writer(output)
+    writer.writerow(["function", "exclusive", "inclusive",
+                     "exclusive_percent"])
+    exclusive = result.total("exclusive", result.throws)
+    inclusive = result.total("inclusive", result.throws)
+    total = result.instructions or 1
+    for function, count in exclusive.most_common():
+        writer.writerow([function, count, inclusive[function],
+                         f"{100 * count / total:.2f}"])
+
+
+def write_throws(result: trace_profile, output):
+    writer = csv.writer(output)
+    writer.writerow(["throw", "first_step", "instructions", "complete"] +
+                    CATEGORY_NAMES)
+    for index, throw in enumerate(result.throws):
+        writer.writerow([index, throw.first_step, throw.instructions,
+                         int(throw.complete)] +
+                        [throw.categories[name] for name in CATEGORY_NAMES])
+
+
+def write_collapsed(result: trace_profile, output):
+    """flamegraph.pl / speedscope folded stacks, one instruction per sample"""
+    for stack, count in sorted(result.stacks.items()):
+        output.write(f"{stack} {count}\n")
+
+
+def write_diff(before: trace_profile, after: trace_profile, per_throw: bool,
+               by_category: bool, output):
+    def totals(result: trace_profile, counts: str) -> Dict[str, float]:
+        throws = result.throws
+        if per_throw:
+            # A trace usually ends in the middle of a throw, leave it out
+            throws = result.complete_throws() or result.throws
+        counter = result.total(counts, throws)
+        divisor = len(throws) if per_throw and throws else 1
+        return {name: count / divisor for name, count in counter.items()}
+
+    def value(count: float) -> str:
+        return f"{count:.1f}" if per_throw else str(int(count))
+
+    writer = csv.writer(output)
+    if by_category:
+        a = totals(before, "categories")
+        b = totals(after, "categories")
+        writer.writerow(["category", "before", "after", "delta"])
+        for name in CATEGORY_NAMES:
+            writer.writerow([name, value(a.get(name, 0)),
+                             value(b.get(name, 0)),
+                             value(b.get(name, 0) - a.get(name, 0))])
+        return
+
+    writer.writerow(["function", "before_exclusive", "after_exclusive",
+                     "delta_exclusive", "before_inclusive", "after_inclusive",
+                     "delta_inclusive"])
+    before_exclusive = totals(before, "exclusive")
+    after_exclusive = totals(after, "exclusive")
+    before_inclusive = totals(before, "inclusive")
+    after_inclusive = totals(after, "inclusive")
+    rows = []
+    for function in set(before_exclusive) | set(after_exclusive):
+        a_exclusive = before_exclusive.get(function, 0)
+        b_exclusive = after_exclusive.get(function, 0)
+        a_inclusive = before_inclusive.get(function, 0)
+        b_inclusive = after_inclusive.get(function, 0)
+        rows.append((function, a_exclusive, b_exclusive,
+                     b_exclusive - a_exclusive, a_inclusive, b_inclusive,
+                     b_inclusive - a_inclusive))
+    # Largest changes first
+    rows.sort(key=lambda row: (-abs(row[3]), row[0]))
+    for row in rows:
+        writer.writerow([row[0]] + [value(count) for count in row[1:]])
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Summarize and compare instruction traces of throws")
+    parser.add_argument("-o", "--output", type=Path,
+                        help="File to write, stdout by default")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    command = commands.add_parser(
+        "functions", help="Exclusive and inclusive instructions per function")
+    command.add_argument("trace", type=Path)
+
+    command = commands.add_parser(
+        "throws", help="Instructions of every throw per category")
+    command.add_argument("trace", type=Path)
+
+    command = commands.add_parser(
+        "collapse", help="Collapsed stacks for flame graphs")
+    command.add_argument("trace", type=Path)
+
+    command = commands.add_parser(
+        "diff", help="Side by side comparison of two traces")
+    command.add_argument("before", type=Path)
+    command.add_argument("after", type=Path)
+    command.add_argument("--per-throw", action="store_true",
+                         help="Divide the counts by the number of throws of "
+                              "each trace")
+    command.add_argument("--by-category", action="store_true",
+                         help="Compare the categories instead of functions")
+
+    args = parser.parse_args()
+    output = args.output.open("w", newline="") if args.output else sys.stdout
+
+    if args.command == "functions":
+        write_functions(profile(args.trace), output)
+    elif args.command == "throws":
+        write_throws(profile(args.trace), output)
+    elif args.command == "collapse":
+        write_collapsed(profile(args.trace), output)
+    elif args.command == "diff":
+        before = profile(args.before)
+        after = profile(args.after)
+        print(f"{args.before}: {len(before.throws)} throws "
+              f"({len(before.complete_throws())} complete), "
+              f"{before.instructions} instructions",
+              file=sys.stderr)
+        print(f"{args.after}: {len(after.throws)} throws "
+              f"({len(after.complete_throws())} complete), "
+              f"{after.instructions} instructions", file=sys.stderr)
+        write_diff(before, after, args.per_throw, args.by_category, output)
+
+    if args.output:
+        output.close()
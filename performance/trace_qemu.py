@@ -0,0 +1,176 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Records every instruction of every throw of a QEMU benchmark, in the
+`step,function,address` schema of the machine_code_steps*.csv traces.
+
+The image runs once under qemu-system-arm with the exception_trace TCG plugin
+of qemu_trace/. The plugin records from the entry of `__cxa_throw` until
+control is back in the catching function, `start` by default, for each
+throw. The addresses are resolved to functions with the ELF's symbol table.
+
+    python3 trace_qemu.py build/MinSizeRel/except_experimental.qemu.elf \\
+        -o machine_code_steps.csv
+
+Steps are numbered across the whole run. With `--split-dir` every throw goes
+to its own `throw_<n>.csv` instead, numbered from 0. The first pass of
+`start()` throws each group once, so `--limit 25` stops after it.
+
+The plugin is built from qemu_trace/ into `build/qemu_trace` on first use.
+Pass `--plugin-include` if CMake cannot find qemu-plugin.h.
+"""
+
+import argparse
+import bisect
+import csv
+import struct
+import subprocess
+import sys
+from pathlib import Path
+from typing import Iterator, List, Optional
+
+from elf_reader import elf_file, elf_symbol
+from run_qemu import qemu_command
+
+PERFORMANCE_DIR = Path(__file__).resolve().parent
+END_OF_THROW = 0xFFFFFFFF
+
+
+def build_plugin(build: Path, include: Optional[Path]) -> Path:
+    command = ["cmake", "-S", str(PERFORMANCE_DIR / "qemu_trace"),
+               "-B", str(build), "-DCMAKE_BUILD_TYPE=Release"]
+    if include is not None:
+        command.append(f"-DQEMU_PLUGIN_INCLUDE_DIR={include.resolve()}")
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(["cmake", "--build", str(build)], check=True,
+                   stdout=subprocess.DEVNULL)
+    return build / "libexception_trace.so"
+
+
+def function_symbol(elf: elf_file, name: str) -> elf_symbol:
+    for function in elf.functions():
+        if function.name == name:
+            return function
+    raise RuntimeError(f"{elf.path} has no function {name}")
+
+
+class symbolizer:
+    def __init__(self, elf: elf_file):
+        self.functions = elf.functions()
+        self.starts = [function.value for function in self.functions]
+
+    def name(self, address: int) -> str:
+        index = bisect.bisect_right(self.starts, address) - 1
+        if index < 0:
+            return "??"
+        function = self.functions[index]
+        if function.size and address >= function.value + function.size:
+            return "??"
+        return function.name
+
+
+def read_throws(trace: Path) -> Iterator[List[int]]:
+    data = trace.read_bytes()
+    throw: List[int] = []
+    for (address,) in struct.iter_unpack("<I", data[:len(data) // 4 * 4]):
+        if address == END_OF_THROW:
+            yield throw
+            throw = []
+        else:
+            throw.append(address)
+    if throw:
+        yield throw
+
+
+def write_steps(writer, symbols: symbolizer, addresses: List[int],
+                first_step: int) -> int:
+    for step, address in enumerate(addresses, first_step):
+        writer.writerow([step, symbols.name(address), f"0x{address:08x}"])
+    return first_step + len(addresses)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Trace every throw of a benchmark under QEMU")
+    parser.add_argument("elf", type=Path, help="QEMU image to run")
+    parser.add_argument("-o", "--output", type=Path,
+                        help="CSV to write, stdout by default")
+    parser.add_argument("--split-dir", type=Path,
+                        help="Write one throw_<n>.csv per throw here instead")
+    parser.add_argument("--catch", default="start",
+                        help="Function whose handler ends each throw")
+    parser.add_argument("--throw", default="__cxa_throw",
+                        help="Function that starts each throw")
+    parser.add_argument("-l", "--limit", type=int,
+                        help="Number of throws to record, all by default")
+    parser.add_argument("-q", "--qemu", default="qemu-system-arm",
+                        help="Path to qemu-system-arm")
+    parser.add_argument("--plugin", type=Path,
+                        help="Prebuilt libexception_trace.so")
+    parser.add_argument("--plugin-include", type=Path,
+                        help="Directory of qemu-plugin.h for the plugin build")
+    parser.add_argument("-b", "--build-dir", type=Path,
+                        default=Path("build/qemu_trace"),
+                        help="Directory for the plugin build and raw trace")
+    parser.add_argument("-t", "--timeout", type=int, default=120,
+                        help="Seconds before the run is considered hung")
+    args = parser.parse_args()
+
+    args.build_dir.mkdir(parents=True, exist_ok=True)
+    plugin = args.plugin or build_plugin(args.build_dir, args.plugin_include)
+
+    elf = elf_file(args.elf)
+    throw = function_symbol(elf, args.throw)
+    catch = function_symbol(elf, args.catch)
+    trace = (args.build_dir / "exception_trace.bin").resolve()
+    plugin_arguments = [f"{plugin.resolve()}",
+                        f"throw=0x{throw.value:x}",
+                        f"catch_start=0x{catch.value:x}",
+                        f"catch_end=0x{catch.value + catch.size:x}",
+                        f"output={trace}"]
+    if args.limit is not None:
+        plugin_arguments.append(f"limit={args.limit}")
+
+    command = qemu_command(args.qemu, args.elf)
+    command += ["-plugin", ",".join(plugin_arguments)]
+    # The benchmark writes its own CSV through semihosting, keep it out of
+    # the working directory
+    subprocess.run(command, cwd=args.build_dir, timeout=args.timeout,
+                   check=True, stdin=subprocess.DEVNULL,
+                   stdout=subprocess.DEVNULL)
+
+    symbols = symbolizer(elf)
+    if args.split_dir is not None:
+        args.split_dir.mkdir(parents=True, exist_ok=True)
+        count = 0
+        for count, addresses in enumerate(read_throws(trace), 1):
+            path = args.split_dir / f"throw_{count - 1}.csv"
+            with path.open("w", newline="") as output:
+                writer = csv.writer(output)
+                writer.writerow(["step", "function", "address"])
+                write_steps(writer, symbols, addresses, 0)
+        print(f"{count} throws written to {args.split_dir}", file=sys.stderr)
+    else:
+        output = (args.output.open("w", newline="") if args.output
+                  else sys.stdout)
+        writer = csv.writer(output)
+        writer.writerow(["step", "function", "address"])
+        step = 0
+        for addresses in read_throws(trace):
+            step = write_steps(writer, symbols, addresses, step)
+        if args.output:
+            output.close()
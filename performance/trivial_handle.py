@@ -0,0 +1,233 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Post-link tool that finds the functions an exception passes through without
+running any code and writes a linker script fragment that groups them between
+`__trivial_handle_start` and `__trivial_handle_end`.
+
+A function is trivial when its `.ARM.exidx` entry can unwind it and it has no
+cleanups or handlers:
+
+    inline compact model     - always trivial
+    compact model in extab   - trivial if there are no scope descriptors
+    __gxx_personality_v0     - trivial if its LSDA call site table covers the
+                               whole function with no landing pads or actions
+    EXIDX_CANTUNWIND, other  - never trivial
+
+`standard_arm.ld` includes `trivial_handle.ld` at the start of `.text`, the
+empty one next to this script is used until the tool has generated one.
+Functions are matched by their `-ffunction-sections` input section, so the
+image has to be linked again with the generated fragment first in the library
+search path:
+
+    python3 trivial_handle.py build/MinSizeRel/except.elf \\
+        -o build/MinSizeRel/except.trivial_handle/trivial_handle.ld
+
+The set of trivial functions does not depend on where they are placed, so one
+relink is enough.
+"""
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+from elf_reader import elf_file, elf_symbol
+from exidx_index import selfrel_offset31
+from parse_exception_index import describe_instruction2
+
+EXIDX_CANTUNWIND = 1
+DW_EH_PE_omit = 0xFF
+DW_EH_PE_uleb128 = 0x01
+DW_EH_PE_udata2 = 0x02
+DW_EH_PE_udata4 = 0x03
+
+# GCC puts code in .text.<name> with -ffunction-sections, or in one of these
+# prefixes when it knows how often the function runs.
+_SECTION_PREFIXES = [".text", ".text.unlikely", ".text.startup", ".text.hot"]
+
+
+def read_uleb128(data: bytes, offset: int) -> Tuple[int, int]:
+    result = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return result, offset
+
+
+def read_encoded(data: bytes, offset: int,
+                 encoding: int) -> Optional[Tuple[int, int]]:
+    if encoding == DW_EH_PE_uleb128:
+        return read_uleb128(data, offset)
+    if encoding == DW_EH_PE_udata2:
+        return struct.unpack_from("<H", data, offset)[0], offset + 2
+    if encoding == DW_EH_PE_udata4:
+        return struct.unpack_from("<I", data, offset)[0], offset + 4
+    return None
+
+
+def lsda_is_trivial(elf: elf_file, lsda: int, function_size: int) -> bool:
+    """
+    True if every call site of the function has no landing pad and no action.
+    An address missing from the call site table calls std::terminate, so the
+    table must also cover the whole function.
+    """
+    section = elf.section_at(lsda)
+    if section is None or function_size == 0:
+        return False
+    data = elf.section_data(section)
+    offset = lsda - section.address
+
+    lpstart_encoding = data[offset]
+    offset += 1
+    if lpstart_encoding != DW_EH_PE_omit:
+        return False
+
+    ttype_encoding = data[offset]
+    offset += 1
+    if ttype_encoding != DW_EH_PE_omit:
+        _, offset = read_uleb128(data, offset)
+
+    call_site_encoding = data[offset]
+    offset += 1
+    table_length, offset = read_uleb128(data, offset)
+    table_end = offset + table_length
+
+    covered = 0
+    while offset < table_end:
+        fields = []
+        for _ in range(3):
+            value = read_encoded(data, offset, call_site_encoding)
+            if value is None:
+                return False
+            fields.append(value[0])
+            offset = value[1]
+        action, offset = read_uleb128(data, offset)
+        start, length, landing_pad = fields
+        if landing_pad != 0 or action != 0 or start != covered:
+            return False
+        covered = start + length
+
+    return covered >= function_size
+
+
+def classify(elf: elf_file, functions: Dict[int, elf_symbol],
+             entry_address: int, content: int,
+             function: elf_symbol) -> Tuple[bool, int]:
+    """Returns (trivial, first unwind instruction word) of an exidx entry"""
+    if content == EXIDX_CANTUNWIND:
+        return False, content
+    if content & 0x80000000:
+        # Inline compact model, there is no room for descriptors
+        return True, content
+
+    extab = selfrel_offset31(content, entry_address + 4)
+    header = elf.read_u32(extab)
+    if header & 0x80000000:
+        # Compact model with its descriptors after the opcodes, GCC never
+        # emits any but a 0 word is required to end the list.
+        index = (header >> 24) & 0xF
+        extra_words = 0 if index == 0 else (header >> 16) & 0xFF
+        descriptors = extab + 4 * (1 + extra_words)
+        return elf.read_u32(descriptors) == 0, header
+
+    personality = selfrel_offset31(header, extab)
+    symbol = functions.get(personality & ~1)
+    if symbol is None or symbol.name != "__gxx_personality_v0":
+        return False, header
+
+    opcodes = elf.read_u32(extab + 4)
+    lsda = extab + 4 * (2 + ((opcodes >> 24) & 0xFF))
+    return lsda_is_trivial(elf, lsda, function.size), opcodes
+
+
+def find_trivial_functions(elf: elf_file) -> Tuple[List[str], int,
+                                                    Dict[str, int]]:
+    start = elf.symbol("__exidx_start")
+    end = elf.symbol("__exidx_end")
+    if start is None or end is None:
+        raise RuntimeError("__exidx_start/__exidx_end not found, is this an "
+                           "ARM EHABI image linked with standard_arm.ld?")
+
+    functions = {symbol.value: symbol for symbol in elf.functions()}
+    table = elf.read(start.value, end.value - start.value)
+
+    # A name is only safe to move if every function with that name, such as
+    # static functions in different translation units, is trivial.
+    verdicts: Dict[str, bool] = {}
+    opcodes: Dict[str, int] = {}
+    count = len(table) // 8
+    for index in range(count):
+        entry_address = start.value + index * 8
+        fnoffset, content = struct.unpack_from("<II", table, index * 8)
+        function = functions.get(selfrel_offset31(fnoffset, entry_address))
+        if function is None:
+            continue
+        trivial, first_word = classify(elf, functions, entry_address,
+                                       content, function)
+        verdicts[function.name] = verdicts.get(function.name, True) and trivial
+        opcodes[function.name] = first_word
+
+    trivial = sorted(name for name, verdict in verdicts.items() if verdict)
+    return trivial, count, opcodes
+
+
+def generate_fragment(names: List[str]) -> str:
+    lines = [
+        "/* Generated by trivial_handle.py, do not edit */",
+    ]
+    for name in names:
+        patterns = " ".join(f"{prefix}.{name}" for prefix in _SECTION_PREFIXES)
+        lines.append(f"*({patterns})")
+    return "\n".join(lines) + "\n"
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Write a linker script fragment that places every "
+                    "function without cleanups or handlers in "
+                    ".trivial_handle")
+    parser.add_argument("elf", type=Path)
+    parser.add_argument("-o", "--output", type=Path, required=True,
+                        help="Fragment to write, named trivial_handle.ld")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="List the trivial functions and their unwind "
+                             "instructions")
+    args = parser.parse_args()
+
+    try:
+        elf = elf_file(args.elf)
+        names, count, opcodes = find_trivial_functions(elf)
+    except RuntimeError as error:
+        print(f"{args.elf}: {error}", file=sys.stderr)
+        sys.exit(1)
+
+    if args.verbose:
+        for name in names:
+            word = opcodes[name]
+            print(f"{name}: {describe_instruction2(word)}")
+
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text(generate_fragment(names))
+
+    print(f"{args.elf}: {len(names)} trivial functions in {count} "
+          f".ARM.exidx entries, wrote {args.output}")
@@ -0,0 +1,69 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+/// 1 lets __gnu_unwind_execute apply the records of .unwind_records
+#if !defined(UNWIND_RECORDS)
+#define UNWIND_RECORDS 0
+#endif
+
+// Layout of the .unwind_records section, see unwind_records.py. Record i
+// describes the unwind instructions of .ARM.exidx entry i.
+
+constexpr std::uint32_t unwind_records_format = 1;
+
+struct unwind_records_header
+{
+  /// 0 until unwind_records.py has been run
+  std::uint32_t format;
+  std::uint32_t count;
+};
+
+/// The record can be applied instead of running the bytecode
+constexpr std::uint8_t unwind_record_fast = 1 << 0;
+/// The frame has a personality routine with an LSDA or scope descriptors
+constexpr std::uint8_t unwind_record_has_lsda = 1 << 1;
+
+/**
+ * @brief The unwind instructions of one function in a single shape
+ *
+ * Applied in field order:
+ *
+ *     vsp = r[vsp_register]
+ *     vsp += sp_words * 4
+ *     pop {d[vfp_first]-d[vfp_first + vfp_count - 1]}
+ *     pop {core_mask}
+ *     vsp += sp_words_after * 4
+ *     pc = lr, unless core_mask pops pc
+ *
+ * This covers the prologues GCC emits for Cortex-M. Bytecode that does not
+ * fit, such as vsp decrements, FLDMX pops or large frames, leaves
+ * unwind_record_fast cleared.
+ */
+struct unwind_record
+{
+  std::uint16_t core_mask;
+  std::uint8_t sp_words;
+  std::uint8_t sp_words_after;
+  /// 13 (sp) leaves vsp alone
+  std::uint8_t vsp_register;
+  std::uint8_t vfp_first;
+  std::uint8_t vfp_count;
+  std::uint8_t flags;
+};
+
+static_assert(sizeof(unwind_record) == 8);
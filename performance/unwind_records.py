@@ -0,0 +1,294 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Post-link tool that decodes the EHABI unwind bytecode of every `.ARM.exidx`
+entry into a fixed width record in the `.unwind_records` section of an ELF.
+
+`__gnu_unwind_execute` interprets the bytecode one byte at a time for every
+frame, while nearly every Cortex-M function unwinds with the same steps:
+
+    vsp = r7             (frame pointer functions only)
+    vsp += N             (locals)
+    pop {d8-d15}         (functions that use callee saved VFP registers)
+    pop {r4-r11, lr}
+
+Each record stores those steps, see unwind_record.hpp for the layout:
+
+    struct unwind_records_header {
+        uint32_t format;  // 0 until this tool has been run
+        uint32_t count;   // number of .ARM.exidx entries
+    };
+    struct unwind_record {
+        uint16_t core_mask;
+        uint8_t sp_words;
+        uint8_t sp_words_after;
+        uint8_t vsp_register;
+        uint8_t vfp_first;
+        uint8_t vfp_count;
+        uint8_t flags;    // 1: fast, 2: has LSDA
+    };
+
+Bytecode with any other shape gets a record without the fast flag and keeps
+going through the interpreter.
+
+Usage:
+
+    python3 unwind_records.py build/MinSizeRel/except_experimental.elf
+"""
+
+import argparse
+import struct
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import List, Optional
+
+from elf_reader import elf_file
+from exidx_index import selfrel_offset31
+
+FORMAT = 1
+EXIDX_CANTUNWIND = 1
+R_SP = 13
+R_LR = 14
+R_PC = 15
+
+RECORD_FAST = 1 << 0
+RECORD_HAS_LSDA = 1 << 1
+
+_HEADER_FORMAT = "<II"
+_RECORD_FORMAT = "<HBBBBBB"
+
+
+@dataclass
+class unwind_record:
+    core_mask: int = 0
+    sp_words: int = 0
+    sp_words_after: int = 0
+    vsp_register: int = R_SP
+    vfp_first: int = 0
+    vfp_count: int = 0
+    flags: int = 0
+
+    def pack(self) -> bytes:
+        return struct.pack(_RECORD_FORMAT, self.core_mask, self.sp_words,
+                           self.sp_words_after, self.vsp_register,
+                           self.vfp_first, self.vfp_count, self.flags)
+
+
+def word_bytes(word: int, count: int) -> List[int]:
+    """The lowest `count` bytes of word, most significant first"""
+    return [(word >> (8 * index)) & 0xFF for index in reversed(range(count))]
+
+
+def read_bytecode(elf: elf_file, entry_address: int,
+                  content: int) -> Optional[tuple]:
+    """Returns (bytecode, has_lsda) of an exidx entry, None if it has none"""
+    if content == EXIDX_CANTUNWIND:
+        return None
+    if content & 0x80000000:
+        if (content >> 24) & 0xF != 0:
+            return None
+        return word_bytes(content, 3), False
+
+    extab = selfrel_offset31(content, entry_address + 4)
+    header = elf.read_u32(extab)
+    if header & 0x80000000:
+        index = (header >> 24) & 0xF
+        if index == 0:
+            bytecode = word_bytes(header, 3)
+            descriptors = extab + 4
+        elif index in (1, 2):
+            extra_words = (header >> 16) & 0xFF
+            bytecode = word_bytes(header, 2)
+            for word in range(extra_words):
+                bytecode += word_bytes(elf.read_u32(extab + 4 * (1 + word)), 4)
+            descriptors = extab + 4 * (1 + extra_words)
+        else:
+            return None
+        return bytecode, elf.read_u32(descriptors) != 0
+
+    # Generic model: the personality routine, then a word that holds the
+    # number of extra words and the first three bytes.
+    first = elf.read_u32(extab + 4)
+    bytecode = word_bytes(first, 3)
+    for word in range((first >> 24) & 0xFF):
+        bytecode += word_bytes(elf.read_u32(extab + 4 * (2 + word)), 4)
+    return bytecode, True
+
+
+def decode(bytecode: List[int]) -> Optional[unwind_record]:
+    """
+    Fits the bytecode into a record, or None if its steps are not in the
+    order of unwind_record or do not fit its fields.
+    """
+    record = unwind_record()
+    # 0: vsp = r[n], 1: vsp +=, 2: VFP pop, 3: core pops, 4: vsp +=
+    stage = 0
+    sp_bytes = 0
+    sp_bytes_after = 0
+    position = 0
+
+    def next_byte() -> int:
+        nonlocal position
+        if position >= len(bytecode):
+            return 0xB0
+        position += 1
+        return bytecode[position - 1]
+
+    def add_to_vsp(amount: int):
+        nonlocal stage, sp_bytes, sp_bytes_after
+        if stage <= 1:
+            stage = 1
+            sp_bytes += amount
+        else:
+            stage = 4
+            sp_bytes_after += amount
+
+    def pop_core(mask: int) -> bool:
+        nonlocal stage
+        if stage > 3 or mask & (1 << R_SP):
+            return False
+        # Two pops in a row only combine if the second pops higher registers
+        if record.core_mask and (record.core_mask.bit_length() >
+                                 (mask & -mask).bit_length() - 1):
+            return False
+        stage = 3
+        record.core_mask |= mask
+        return True
+
+    while True:
+        op = next_byte()
+        if op == 0xB0:
+            break
+        if op & 0xC0 == 0x00:
+            add_to_vsp(((op & 0x3F) << 2) + 4)
+        elif op & 0xC0 == 0x40:
+            return None
+        elif op & 0xF0 == 0x80:
+            op = (op << 8) | next_byte()
+            if op == 0x8000 or not pop_core((op << 4) & 0xFFF0):
+                return None
+        elif op & 0xF0 == 0x90:
+            register = op & 0xF
+            if stage != 0 or register in (R_SP, R_PC):
+                return None
+            record.vsp_register = register
+            stage = 1
+        elif op & 0xF0 == 0xA0:
+            mask = (0xFF0 >> (7 - (op & 7))) & 0xFF0
+            if op & 8:
+                mask |= 1 << R_LR
+            if not pop_core(mask):
+                return None
+        elif op == 0xB1:
+            mask = next_byte()
+            if mask == 0 or mask & 0xF0 or not pop_core(mask):
+                return None
+        elif op == 0xB2:
+            shift = 2
+            amount = 0x204
+            op = next_byte()
+            while op & 0x80:
+                amount += (op & 0x7F) << shift
+                shift += 7
+                op = next_byte()
+            add_to_vsp(amount + ((op & 0x7F) << shift))
+        elif op in (0xC8, 0xC9) or op & 0xF8 == 0xD0:
+            if op & 0xF8 == 0xD0:
+                first, count = 8, (op & 7) + 1
+            else:
+                registers = next_byte()
+                first = (registers >> 4) + (16 if op == 0xC8 else 0)
+                count = (registers & 0xF) + 1
+            if stage > 1:
+                return None
+            stage = 2
+            record.vfp_first = first
+            record.vfp_count = count
+        else:
+            # FLDMX, FPA, iWMMXt and spare opcodes
+            return None
+
+    if sp_bytes // 4 > 0xFF or sp_bytes_after // 4 > 0xFF:
+        return None
+    record.sp_words = sp_bytes // 4
+    record.sp_words_after = sp_bytes_after // 4
+    record.flags = RECORD_FAST
+    return record
+
+
+def build_records(elf: elf_file) -> tuple:
+    start = elf.symbol("__exidx_start")
+    end = elf.symbol("__exidx_end")
+    if start is None or end is None:
+        raise RuntimeError("__exidx_start/__exidx_end not found, is this an "
+                           "ARM EHABI image linked with standard_arm.ld?")
+
+    table = elf.read(start.value, end.value - start.value)
+    count = len(table) // 8
+    payload = struct.pack(_HEADER_FORMAT, FORMAT, count)
+    fast = 0
+    for index in range(count):
+        entry_address = start.value + index * 8
+        _, content = struct.unpack_from("<II", table, index * 8)
+        decoded = read_bytecode(elf, entry_address, content)
+        record = unwind_record()
+        if decoded is not None:
+            bytecode, has_lsda = decoded
+            record = decode(bytecode) or unwind_record()
+            if has_lsda:
+                record.flags |= RECORD_HAS_LSDA
+        if record.flags & RECORD_FAST:
+            fast += 1
+        payload += record.pack()
+    return payload, count, fast
+
+
+def patch(elf: elf_file, payload: bytes):
+    start = elf.symbol("__unwind_records_start")
+    end = elf.symbol("__unwind_records_end")
+    if start is None or end is None:
+        raise RuntimeError("__unwind_records_start/__unwind_records_end not "
+                           "found, the linker script must reserve "
+                           ".unwind_records")
+
+    reserved = end.value - start.value
+    if len(payload) > reserved:
+        raise RuntimeError(f"records need {len(payload)} bytes but only "
+                           f"{reserved} bytes are reserved")
+
+    elf.write(start.value, payload)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Write a fixed width unwind record for every .ARM.exidx "
+                    "entry into the .unwind_records section of an ELF, in "
+                    "place")
+    parser.add_argument("elf", type=Path)
+    args = parser.parse_args()
+
+    try:
+        elf = elf_file(args.elf)
+        payload, count, fast = build_records(elf)
+        patch(elf, payload)
+        elf.save()
+    except RuntimeError as error:
+        print(f"{args.elf}: {error}", file=sys.stderr)
+        sys.exit(1)
+
+    print(f"{args.elf}: {fast} of {count} unwind records take the fast path")
@@ -0,0 +1,172 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Builds the size test suite written by `generate.py randomize` and collects
+the size of every sample into `info.csv` and `info.json`.
+
+The first run configures `test_suite/` with `conan build`. Later runs reuse
+that configuration and only call `cmake --build`, so only samples whose
+source changed are compiled and linked again. Both build with one job per
+CPU. Section sizes are read from the ELF section headers, in parallel. One
+row per sample:
+
+    sample#,except.text,except.data,except.bss,reserved,
+    result.text,result.data,result.bss,result.checks,
+    except.exidx,except.extab,except.lsda,except.eh_frame,
+    result.exidx,result.extab,result.lsda,result.eh_frame
+
+text, data and bss are what `arm-none-eabi-size` reports. `result.checks` is
+the number of `!result` and `!scoped_result` checks in the result source.
+lsda is `.gcc_except_table`.
+
+Usage:
+
+    python3 generate.py randomize
+    python3 collect_info.py
+"""
+
+import argparse
+import csv
+import json
+import os
+import re
+import subprocess
+import sys
+from concurrent.futures import ProcessPoolExecutor
+from pathlib import Path
+from typing import Dict, List
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent /
+                       "performance"))
+
+from elf_reader import (SHF_ALLOC, SHF_EXECINSTR, SHF_WRITE,  # noqa: E402
+                        SHT_NOBITS, elf_file)
+
+CHECK_EXPRESSION = re.compile(r"!scoped_result|!result")
+# Output section that holds .ARM.exidx, resources/third_party/standard_arm.ld
+# names it .except2
+EXIDX_SECTIONS = [".ARM.exidx", ".except2"]
+# The other tables share .except, the linker script marks their bounds
+EXCEPTION_TABLES = {"extab": ("__extab_start", "__extab_end"),
+                    "lsda": ("__lsda_start", "__lsda_end"),
+                    "eh_frame": ("__eh_frame_start", "__eh_frame_end")}
+COLUMNS = (["sample#"] +
+           [f"except.{name}" for name in ["text", "data", "bss"]] +
+           ["reserved"] +
+           [f"result.{name}" for name in ["text", "data", "bss", "checks"]] +
+           [f"{kind}.{name}" for kind in ["except", "result"]
+            for name in ["exidx"] + list(EXCEPTION_TABLES)])
+
+
+def build(suite: Path, build_dir: Path, profile: Path, jobs: int):
+    generators = build_dir / "generators"
+    if not (build_dir / "CMakeCache.txt").exists():
+        subprocess.run(["conan", "build", str(suite), "-pr", str(profile),
+                        "-c", f"tools.build:jobs={jobs}"], check=True)
+        return
+    # The same environment conan builds in, for the ARM toolchain
+    subprocess.run(["bash", "-c",
+                    f'source "{generators / "conanbuild.sh"}" && '
+                    f'cmake --build "{build_dir}" --parallel {jobs}'],
+                   check=True)
+
+
+def section_sizes(path: Path) -> Dict[str, int]:
+    """Berkeley text/data/bss like `size`, and the unwind tables"""
+    elf = elf_file(path)
+    sizes = {"text": 0, "data": 0, "bss": 0}
+    for section in elf.sections:
+        if not section.flags & SHF_ALLOC:
+            continue
+        if section.type == SHT_NOBITS:
+            sizes["bss"] += section.size
+        elif section.flags & (SHF_EXECINSTR | SHF_WRITE) == SHF_WRITE:
+            sizes["data"] += section.size
+        else:
+            sizes["text"] += section.size
+    sizes["exidx"] = 0
+    for section_name in EXIDX_SECTIONS:
+        section = elf.section(section_name)
+        if section is not None:
+            sizes["exidx"] = section.size
+            break
+    for name, (start_name, end_name) in EXCEPTION_TABLES.items():
+        start = elf.symbol(start_name)
+        end = elf.symbol(end_name)
+        if start is None or end is None:
+            raise RuntimeError(f"{path}: {start_name}/{end_name} not found, "
+                               "run generate.py randomize again to update "
+                               "the suite's linker script")
+        sizes[name] = end.value - start.value
+    return sizes
+
+
+def collect(sample: int, suite: Path, build_dir: Path) -> Dict[str, int]:
+    row = {"sample#": sample, "reserved": 0}
+    for kind in ["except", "result"]:
+        sizes = section_sizes(build_dir / f"{kind}_{sample}.elf")
+        for name, size in sizes.items():
+            row[f"{kind}.{name}"] = size
+    source = (suite / f"result_{sample}.cpp").read_text()
+    row["result.checks"] = len(CHECK_EXPRESSION.findall(source))
+    return {column: row[column] for column in COLUMNS}
+
+
+def find_samples(suite: Path) -> List[int]:
+    return sorted(int(path.stem.split("_")[1])
+                  for path in suite.glob("except_*.cpp"))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Build the size test suite and collect its sizes")
+    parser.add_argument("-s", "--suite", type=Path, default=Path("test_suite"),
+                        help="Directory written by generate.py randomize")
+    parser.add_argument("-p", "--profile", type=Path,
+                        help="Conan profile, defaults to the suite's "
+                             "baremetal.profile")
+    parser.add_argument("-o", "--output-dir", type=Path, default=Path("."),
+                        help="Directory to write info.csv and info.json to")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(),
+                        help="Parallel build jobs and ELF readers")
+    parser.add_argument("--no-build", action="store_true",
+                        help="Only read the ELFs of a previous build")
+    args = parser.parse_args()
+
+    build_dir = args.suite / "build" / "MinSizeRel"
+    if not args.no_build:
+        build(args.suite, build_dir,
+              args.profile or args.suite / "baremetal.profile", args.jobs)
+
+    samples = find_samples(args.suite)
+    try:
+        with ProcessPoolExecutor(max_workers=args.jobs) as executor:
+            rows = list(executor.map(collect, samples,
+                                     [args.suite] * len(samples),
+                                     [build_dir] * len(samples)))
+    except RuntimeError as error:
+        print(error, file=sys.stderr)
+        sys.exit(1)
+
+    args.output_dir.mkdir(parents=True, exist_ok=True)
+    with (args.output_dir / "info.csv").open("w", newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=COLUMNS)
+        writer.writeheader()
+        writer.writerows(rows)
+    (args.output_dir / "info.json").write_text(json.dumps(rows, indent=2) +
+                                               "\n")
+    print(args.output_dir / "info.csv")
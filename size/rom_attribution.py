@@ -0,0 +1,374 @@
+#!/usr/bin/python
+#
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Attributes the ROM of the size suite to the functions of each sample, from
+the `except_<n>.elf` and `result_<n>.elf` that `collect_info.py` built.
+
+A function belongs to the sample when the line table places any of its
+instructions in the sample's source. Its bytes are split into:
+
+    except.body          code that is not a landing pad
+    except.landing_pads  code from the first landing pad of its LSDA to the
+                         end of the function, where GCC places them
+    except.exidx         its 8 byte .ARM.exidx entry
+    except.extab         its .ARM.extab entry: unwind opcodes and LSDA
+    except.call_sites    LSDA call sites that have a landing pad
+    result.body          code that is not error propagation
+    result.propagation   code the line table puts on an `if (!x)` check
+                         followed by `return tl::unexpected(x.error())`
+    result.checks        those checks with code in the function
+
+Code inlined from tl::expected is attributed to its header, so it counts as
+body. Its out of line instantiations grow with the sample's types, so they
+are rows of their own. Everything else in the image is the runtime: the ROM
+(text + data) outside the sample's functions and their unwind tables. The
+difference between the two runtimes is the fixed cost of exceptions.
+
+Writes `rom_attribution.csv` with a row per function, `rom_runtime.csv` with
+a row per sample and `rom_model.json` with the cost per call site and check
+over every sample:
+
+    python3 collect_info.py
+    python3 rom_attribution.py
+"""
+
+import argparse
+import csv
+import json
+import re
+import statistics
+import struct
+import sys
+from collections import defaultdict
+from concurrent.futures import ProcessPoolExecutor
+from pathlib import Path
+from typing import Dict, List, Optional, Set, Tuple
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent /
+                       "performance"))
+
+from collect_info import find_samples, section_sizes  # noqa: E402
+from dwarf_line import line_ranges  # noqa: E402
+from elf_reader import elf_file, elf_symbol  # noqa: E402
+from exidx_index import selfrel_offset31  # noqa: E402
+from trivial_handle import (DW_EH_PE_omit, EXIDX_CANTUNWIND,  # noqa: E402
+                            read_encoded, read_uleb128)
+
+SHT_ARM_EXIDX = 0x70000001
+
+FUNCTION_COLUMNS = ["sample#", "function",
+                    "except.body", "except.landing_pads", "except.exidx",
+                    "except.extab", "except.call_sites",
+                    "result.body", "result.propagation", "result.checks"]
+RUNTIME_COLUMNS = ["sample#", "except.runtime", "result.runtime",
+                   "exception_runtime"]
+
+CHECK_LINE = re.compile(r"!\s*(\w+)\s*\)")
+# Mangled members of namespace tl, qualifiers first
+TL_EXPECTED_CODE = re.compile(r"_ZN[KVRO]*2tl")
+
+
+def lsda_call_sites(elf: elf_file,
+                    lsda: int) -> List[Tuple[int, int, int, int]]:
+    """(start, length, landing pad, action) of every LSDA call site"""
+    section = elf.section_at(lsda)
+    if section is None:
+        return []
+    data = elf.section_data(section)
+    offset = lsda - section.address
+
+    lpstart_encoding = data[offset]
+    offset += 1
+    if lpstart_encoding != DW_EH_PE_omit:
+        # GCC always omits it, the landing pads are relative to the function
+        return []
+
+    ttype_encoding = data[offset]
+    offset += 1
+    if ttype_encoding != DW_EH_PE_omit:
+        _, offset = read_uleb128(data, offset)
+
+    call_site_encoding = data[offset]
+    offset += 1
+    table_length, offset = read_uleb128(data, offset)
+    table_end = offset + table_length
+
+    call_sites = []
+    while offset < table_end:
+        fields = []
+        for _ in range(3):
+            value = read_encoded(data, offset, call_site_encoding)
+            if value is None:
+                return call_sites
+            fields.append(value[0])
+            offset = value[1]
+        action, offset = read_uleb128(data, offset)
+        call_sites.append((fields[0], fields[1], fields[2], action))
+    return call_sites
+
+
+def exidx_bounds(elf: elf_file) -> Optional[Tuple[int, int]]:
+    start = elf.symbol("__exidx_start")
+    end = elf.symbol("__exidx_end")
+    if start is not None and end is not None:
+        return start.value, end.value
+    for section in elf.sections:
+        if section.type == SHT_ARM_EXIDX:
+            return section.address, section.address + section.size
+    return None
+
+
+def unwind_tables(elf: elf_file) -> Dict[int, dict]:
+    """exidx, extab and landing pad details by function address"""
+    bounds = exidx_bounds(elf)
+    if bounds is None:
+        return {}
+    functions = {symbol.value: symbol for symbol in elf.functions()}
+    table = elf.read(bounds[0], bounds[1] - bounds[0])
+
+    entries = {}
+    for index in range(len(table) // 8):
+        entry_address = bounds[0] + index * 8
+        fnoffset, content = struct.unpack_from("<II", table, index * 8)
+        address = selfrel_offset31(fnoffset, entry_address) & ~1
+        extab = None
+        if content != EXIDX_CANTUNWIND and not content & 0x80000000:
+            extab = selfrel_offset31(content, entry_address + 4)
+        entries[address] = {"exidx": 8, "extab_address": extab,
+                            "extab": 0, "landing_pads": 0, "call_sites": 0}
+
+    # An extab entry runs until the next one or the end of its section
+    starts = sorted({entry["extab_address"] for entry in entries.values()
+                     if entry["extab_address"] is not None})
+    sizes = {}
+    for number, start in enumerate(starts):
+        section = elf.section_at(start)
+        end = section.address + section.size if section else start
+        if number + 1 < len(starts):
+            end = min(end, starts[number + 1])
+        sizes[start] = end - start
+
+    for address, entry in entries.items():
+        extab = entry["extab_address"]
+        if extab is None:
+            continue
+        entry["extab"] = sizes[extab]
+        header = elf.read_u32(extab)
+        if header & 0x80000000:
+            # Compact model, no LSDA
+            continue
+        personality = functions.get(selfrel_offset31(header, extab) & ~1)
+        if personality is None or personality.name != "__gxx_personality_v0":
+            continue
+        function = functions.get(address)
+        if function is None:
+            continue
+        opcodes = elf.read_u32(extab + 4)
+        lsda = extab + 4 * (2 + ((opcodes >> 24) & 0xFF))
+        pads = [landing_pad for _, _, landing_pad, _ in
+                lsda_call_sites(elf, lsda) if landing_pad != 0]
+        entry["call_sites"] = len(pads)
+        if pads:
+            entry["landing_pads"] = max(function.size - min(pads), 0)
+    return entries
+
+
+def propagation_lines(source: Path) -> Tuple[Set[int], Dict[int, int]]:
+    """
+    Lines of every `if (!x)` check that returns x.error() on the next line,
+    and the check each of those lines belongs to
+    """
+    lines = source.read_text().splitlines()
+    owned: Set[int] = set()
+    check_of: Dict[int, int] = {}
+    for index, line in enumerate(lines[:-1]):
+        match = CHECK_LINE.search(line)
+        if match is None or "if" not in line:
+            continue
+        returned = f"return tl::unexpected({match.group(1)}.error())"
+        if returned in lines[index + 1]:
+            # Line numbers start at 1
+            for number in (index + 1, index + 2):
+                owned.add(number)
+                check_of[number] = index + 1
+    return owned, check_of
+
+
+def sample_functions(elf: elf_file, source_name: str,
+                     lines: Set[int]) -> Dict[str, dict]:
+    """
+    Functions with code from source_name and tl::expected instantiations,
+    with the bytes and checks the line table puts on `lines`
+    """
+    functions = [function for function in elf.functions()
+                 if function.size > 0]
+    starts = [function.value for function in functions]
+    result: Dict[str, dict] = {}
+
+    def containing(address: int) -> Optional[elf_symbol]:
+        # Binary search over the sorted function starts
+        low, high = 0, len(starts)
+        while low < high:
+            middle = (low + high) // 2
+            if starts[middle] <= address:
+                low = middle + 1
+            else:
+                high = middle
+        if low == 0:
+            return None
+        function = functions[low - 1]
+        if address < function.value + function.size:
+            return function
+        return None
+
+    for row in line_ranges(elf):
+        if Path(row.file).name != source_name:
+            continue
+        function = containing(row.start)
+        if function is None:
+            continue
+        info = result.setdefault(function.name, {
+            "address": function.value, "size": function.size,
+            "marked": 0, "marked_lines": set()})
+        if row.line in lines:
+            end = min(row.end, function.value + function.size)
+            info["marked"] += end - row.start
+            info["marked_lines"].add(row.line)
+
+    for function in functions:
+        if (function.name not in result and
+                TL_EXPECTED_CODE.match(function.name)):
+            result[function.name] = {
+                "address": function.value, "size": function.size,
+                "marked": 0, "marked_lines": set()}
+    return result
+
+
+def attribute(sample: int, suite: Path, build_dir: Path) -> tuple:
+    except_elf = elf_file(build_dir / f"except_{sample}.elf")
+    result_elf = elf_file(build_dir / f"result_{sample}.elf")
+
+    tables = unwind_tables(except_elf)
+    except_functions = sample_functions(except_elf, f"except_{sample}.cpp",
+                                        set())
+    lines, check_of = propagation_lines(suite / f"result_{sample}.cpp")
+    result_functions = sample_functions(result_elf, f"result_{sample}.cpp",
+                                        lines)
+
+    rows = []
+    except_owned = 0
+    for name in sorted(set(except_functions) | set(result_functions)):
+        row = {"sample#": sample, "function": name}
+        if name in except_functions:
+            function = except_functions[name]
+            entry = tables.get(function["address"], {})
+            landing_pads = entry.get("landing_pads", 0)
+            row.update({
+                "except.body": function["size"] - landing_pads,
+                "except.landing_pads": landing_pads,
+                "except.exidx": entry.get("exidx", 0),
+                "except.extab": entry.get("extab", 0),
+                "except.call_sites": entry.get("call_sites", 0)})
+            except_owned += (function["size"] + entry.get("exidx", 0) +
+                             entry.get("extab", 0))
+        if name in result_functions:
+            function = result_functions[name]
+            checks = {check_of[line] for line in function["marked_lines"]}
+            row.update({
+                "result.body": function["size"] - function["marked"],
+                "result.propagation": function["marked"],
+                "result.checks": len(checks)})
+        rows.append(row)
+
+    result_owned = sum(function["size"]
+                       for function in result_functions.values())
+    except_sizes = section_sizes(except_elf.path)
+    result_sizes = section_sizes(result_elf.path)
+    except_runtime = (except_sizes["text"] + except_sizes["data"] -
+                      except_owned)
+    result_runtime = (result_sizes["text"] + result_sizes["data"] -
+                      result_owned)
+    runtime = {"sample#": sample, "except.runtime": except_runtime,
+               "result.runtime": result_runtime,
+               "exception_runtime": except_runtime - result_runtime}
+    return rows, runtime
+
+
+def cost_model(rows: List[dict], runtimes: List[dict]) -> dict:
+    totals: Dict[str, int] = defaultdict(int)
+    for row in rows:
+        for column in FUNCTION_COLUMNS[2:]:
+            totals[column] += row.get(column, 0)
+    functions_with_pads = sum(1 for row in rows
+                              if row.get("except.call_sites", 0) > 0)
+
+    def ratio(numerator: float, denominator: float) -> Optional[float]:
+        return round(numerator / denominator, 2) if denominator else None
+
+    return {
+        "samples": len(runtimes),
+        "bytes_per_check": ratio(totals["result.propagation"],
+                                 totals["result.checks"]),
+        "bytes_per_landing_pad_call_site": ratio(
+            totals["except.landing_pads"] + totals["except.extab"],
+            totals["except.call_sites"]),
+        "exidx_bytes_per_function": 8,
+        "extab_bytes_per_function_with_landing_pads": ratio(
+            totals["except.extab"], functions_with_pads),
+        "exception_runtime_median": statistics.median(
+            runtime["exception_runtime"] for runtime in runtimes)
+        if runtimes else None,
+    }
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Attribute the ROM of the size suite to functions")
+    parser.add_argument("samples", type=int, nargs="*",
+                        help="Sample numbers, every sample by default")
+    parser.add_argument("-s", "--suite", type=Path, default=Path("test_suite"),
+                        help="Directory written by generate.py randomize")
+    parser.add_argument("-o", "--output-dir", type=Path, default=Path("."),
+                        help="Directory to write the results to")
+    parser.add_argument("-j", "--jobs", type=int,
+                        help="Samples analyzed in parallel")
+    args = parser.parse_args()
+
+    build_dir = args.suite / "build" / "MinSizeRel"
+    samples = args.samples or find_samples(args.suite)
+    with ProcessPoolExecutor(max_workers=args.jobs) as executor:
+        results = list(executor.map(attribute, samples,
+                                    [args.suite] * len(samples),
+                                    [build_dir] * len(samples)))
+    rows = [row for sample_rows, _ in results for row in sample_rows]
+    runtimes = [runtime for _, runtime in results]
+
+    args.output_dir.mkdir(parents=True, exist_ok=True)
+    with (args.output_dir / "rom_attribution.csv").open(
+            "w", newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=FUNCTION_COLUMNS)
+        writer.writeheader()
+        writer.writerows(rows)
+    with (args.output_dir / "rom_runtime.csv").open("w",
+                                                    newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=RUNTIME_COLUMNS)
+        writer.writeheader()
+        writer.writerows(runtimes)
+    model = cost_model(rows, runtimes)
+    (args.output_dir / "rom_model.json").write_text(
+        json.dumps(model, indent=2) + "\n")
+    print(json.dumps(model, indent=2))